@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Source file for the AnimationEngine class member functions.
+******************************************************************************/
+
+#include "AnimationEngine.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+AnimationEngine::AnimationEngine(const std::vector<ComplexNumber>& circles,
+    real angleStep) : initialCircles{circles}, angleStep{angleStep},
+    frame{0} {
+
+    int count = circles.size();
+    circleR.resize(count);
+    circleI.resize(count);
+    rotorR.resize(count);
+    rotorI.resize(count);
+    for(int i = 0; i < count; i++){
+        circleR[i] = circles[i].getReal();
+        circleI[i] = circles[i].getImaginary();
+        rotorR[i] = cos(getSpeed(i) * angleStep);
+        rotorI[i] = sin(getSpeed(i) * angleStep);
+    }
+}
+
+
+// Get speed function definition
+int AnimationEngine::getSpeed(int index){
+    if(index == 0){
+        return 0;
+    }
+    return (index % 2 == 1) ? (index + 1) / 2 : -(index / 2);
+}
+
+
+// Resynchronize function definition
+void AnimationEngine::resynchronize(){
+    for(int i = 0; i < initialCircles.size(); i++){
+        /**********************************************************************
+         * The angle is reduced to a single turn before cos and sin are
+         * called, so that it stays accurate for any number of frames.
+        **********************************************************************/
+        real angle = std::fmod(getSpeed(i) * (frame * angleStep), 2 * PI);
+        real c = cos(angle);
+        real s = sin(angle);
+        circleR[i] = initialCircles[i].getReal() * c
+            - initialCircles[i].getImaginary() * s;
+        circleI[i] = initialCircles[i].getReal() * s
+            + initialCircles[i].getImaginary() * c;
+    }
+}
+
+
+// Advance function definition
+void AnimationEngine::advance(){
+    frame++;
+    if(frame % RESYNCHRONIZATION_PERIOD == 0){
+        resynchronize();
+        return;
+    }
+
+    int count = circleR.size();
+    for(int i = 0; i < count; i++){
+        real r = circleR[i] * rotorR[i] - circleI[i] * rotorI[i];
+        circleI[i] = circleR[i] * rotorI[i] + circleI[i] * rotorR[i];
+        circleR[i] = r;
+    }
+}
+
+
+// Set frame function definition
+void AnimationEngine::setFrame(long long frame){
+    this->frame = frame;
+    resynchronize();
+}
+
+
+// Get circle number function definition
+int AnimationEngine::getCircleNumber() const{
+    return circleR.size();
+}
+
+
+// Get circle function definition
+ComplexNumber AnimationEngine::getCircle(int index) const{
+    if(index < 0 || index >= circleR.size()){
+        throw std::out_of_range("The index does not exist");
+    }
+    return ComplexNumber(circleR[index], circleI[index]);
+}
+
+
+// Get tip function definition
+ComplexNumber AnimationEngine::getTip() const{
+    real r{0}, i{0};
+    for(int j = 0; j < circleR.size(); j++){
+        r += circleR[j];
+        i += circleI[j];
+    }
+    return ComplexNumber(r, i);
+}
+
+
+// Get frame function definition
+long long AnimationEngine::getFrame() const{
+    return frame;
+}
+
+
+// Get total angle function definition
+real AnimationEngine::getTotalAngle() const{
+    return frame * angleStep;
+}
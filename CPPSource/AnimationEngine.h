@@ -0,0 +1,103 @@
+/******************************************************************************
+ * AnimationEngine.h
+ * Header file for the AnimationEngine class, which turns the circles of a
+ * Fourier series as the animation plays.
+ * Every frame, the circle spinning at speed k turns by k times the angle
+ * step of a frame. Instead of finding each circle's angle with atan2 and
+ * rebuilding it with cos and sin, which is what ComplexNumber::addAngle
+ * does, each circle is multiplied by a unit rotor e^(i * k * step) that is
+ * computed once. A product of rotors slowly drifts in both size and angle,
+ * so every few frames the circles are recomputed exactly from the frame
+ * number, which keeps the error from building up however long the
+ * animation runs.
+******************************************************************************/
+
+#ifndef ANIMATION_ENGINE_H
+#define ANIMATION_ENGINE_H
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+#include "ComplexNumber.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * AnimationEngine class definition.
+     * The circles are kept as separate arrays of real and imaginary parts,
+     * like the phasors of BezierCurveVector::integrateAll, so that a frame
+     * is a plain multiply-add over them.
+    **************************************************************************/
+    class AnimationEngine{
+    public:
+
+        /**********************************************************************
+         * Frames after which the circles are recomputed exactly. An engine
+         * set to a multiple of it matches one that stepped there exactly.
+        **********************************************************************/
+        static constexpr int RESYNCHRONIZATION_PERIOD = 64;
+
+    private:
+
+        // Circles at the start of the animation, which the frames rotate
+        std::vector<ComplexNumber> initialCircles;
+
+        // Current circles, real and imaginary parts
+        std::vector<real> circleR;
+        std::vector<real> circleI;
+
+        // Rotation of each circle per frame, e^(i * k * angleStep)
+        std::vector<real> rotorR;
+        std::vector<real> rotorI;
+
+        real angleStep;     // Angle the slowest circles turn by per frame
+        long long frame;    // Number of frames advanced so far
+
+        /**********************************************************************
+         * Speed of the circle at an index, in turns per turn of the slowest
+         * circles. The first circle doesn't move, then the odd circles
+         * spin at 1, 2, 3 ... and the even ones at -1, -2, -3 ...
+        **********************************************************************/
+        static int getSpeed(int index);
+
+        // Recomputes the circles from the frame number with cos and sin
+        void resynchronize();
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the circles as returned by
+         * FourierSeries::generateCircles and the angle the slowest circles
+         * turn by per frame.
+        **********************************************************************/
+        AnimationEngine(const std::vector<ComplexNumber>& circles,
+            real angleStep);
+
+        // Rotates every circle by one frame
+        void advance();
+
+        /**********************************************************************
+         * Jumps straight to a frame, computing the circles exactly. This
+         * lets several engines render different parts of an animation.
+        **********************************************************************/
+        void setFrame(long long frame);
+
+        int getCircleNumber() const;        // Getter for the circle number
+
+        // Getter for the current value of a circle, throws if out of range
+        ComplexNumber getCircle(int index) const;
+
+        /**********************************************************************
+         * Returns the tip of the chain of circles, which is the sum of all
+         * of them, and traces the image.
+        **********************************************************************/
+        ComplexNumber getTip() const;
+
+        long long getFrame() const;         // Getter for the frame number
+
+        // Total angle the slowest circles have turned by
+        real getTotalAngle() const;
+    };
+}
+
+#endif
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Source file for the BernsteinBasis class member functions.
+******************************************************************************/
+
+#include "BernsteinBasis.h"
+
+using namespace fs;
+
+namespace {
+    // Binomial coefficient C(n, k), built up one factor at a time
+    constexpr real binomial(int n, int k){
+        real result = 1;
+        for(int j = 1; j <= k; j++){
+            result = result * (n - k + j) / j;
+        }
+        return result;
+    }
+
+    // Entry (k, i) of the Bernstein to monomial matrix of a degree
+    constexpr real entry(int degree, int k, int i){
+        if(i > k){
+            return 0;
+        }
+        real sign = ((k - i) % 2 == 0) ? 1 : -1;
+        return sign * binomial(degree, k) * binomial(k, i);
+    }
+
+    constexpr int SIZE = BernsteinBasis::TABLE_DEGREE + 1;
+
+    // Matrices of all the degrees in the table, indexed [degree][k][i]
+    struct Table{
+        real entries[SIZE][SIZE][SIZE];
+    };
+
+    constexpr Table computeTable(){
+        Table table{};
+        for(int degree = 0; degree < SIZE; degree++){
+            for(int k = 0; k <= degree; k++){
+                for(int i = 0; i <= degree; i++){
+                    table.entries[degree][k][i] = entry(degree, k, i);
+                }
+            }
+        }
+        return table;
+    }
+
+    constexpr Table TABLE = computeTable();
+
+    // The cubic matrix, as a check that the table is what it should be
+    static_assert(TABLE.entries[3][3][0] == -1
+        && TABLE.entries[3][2][1] == -6 && TABLE.entries[3][1][1] == 3,
+        "Wrong Bernstein basis matrix");
+}
+
+
+// Get entry function definition
+real BernsteinBasis::getEntry(int degree, int k, int i){
+    if(degree <= TABLE_DEGREE){
+        return TABLE.entries[degree][k][i];
+    }
+    return entry(degree, k, i);
+}
+
+
+// To monomial function definition
+void BernsteinBasis::toMonomial(const real* controls, int degree, real t0,
+    real t1, real* coefficients){
+
+    // Coefficients in s, on the stack unless the degree is unusually high
+    real fixed[SIZE];
+    std::vector<real> dynamic;
+    real* power = fixed;
+    if(degree > TABLE_DEGREE){
+        dynamic.resize(degree + 1);
+        power = dynamic.data();
+    }
+
+    for(int k = 0; k <= degree; k++){
+        power[k] = 0;
+        for(int i = 0; i <= k; i++){
+            power[k] += getEntry(degree, k, i) * controls[i];
+        }
+    }
+
+    /**************************************************************************
+     * s = a + b * t, and the polynomial in t is built with Horner's rule,
+     * multiplying the coefficients found so far by (a + b * t) and adding
+     * the next coefficient in s, from the highest down.
+    **************************************************************************/
+    real a = -t0 / (t1 - t0);
+    real b = 1 / (t1 - t0);
+
+    coefficients[0] = power[degree];
+    for(int k = degree - 1, size = 1; k >= 0; k--, size++){
+        coefficients[size] = coefficients[size - 1] * b;
+        for(int j = size - 1; j > 0; j--){
+            coefficients[j] = coefficients[j] * a + coefficients[j - 1] * b;
+        }
+        coefficients[0] = coefficients[0] * a + power[k];
+    }
+}
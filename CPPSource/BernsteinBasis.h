@@ -0,0 +1,51 @@
+/******************************************************************************
+ * BernsteinBasis.h
+ * Header file for the BernsteinBasis class, which turns the control points
+ * of a Bezier curve directly into the coefficients of its polynomial.
+ * A Bezier curve of degree d is the sum of P[i] * B(i, d)(s) for i = 0 to
+ * d, where B(i, d)(s) = C(d, i) * s^i * (1 - s)^(d - i) are the Bernstein
+ * polynomials and s goes from 0 to 1. Expanding each B(i, d) gives a
+ * matrix M whose entry (k, i) is the coefficient of s^k in B(i, d), which
+ * is C(d, k) * C(k, i) * (-1)^(k - i) when i <= k, and 0 otherwise.
+ * The coefficients in s are then the product of M and the control points,
+ * and substituting s = (t - t0) / (t1 - t0) gives the polynomial in t.
+******************************************************************************/
+
+#ifndef BERNSTEIN_BASIS_H
+#define BERNSTEIN_BASIS_H
+
+#include <vector>
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * BernsteinBasis class definition.
+     * The matrices of degrees up to TABLE_DEGREE are computed at compile
+     * time. Higher degrees are rare, and their entries are computed when
+     * needed instead.
+    **************************************************************************/
+    class BernsteinBasis{
+    public:
+
+        // Largest degree whose matrix is in the compile-time table
+        static constexpr int TABLE_DEGREE = 7;
+
+        /**********************************************************************
+         * Returns the entry (k, i) of the matrix of the given degree, the
+         * coefficient of s^k in the Bernstein polynomial B(i, degree).
+        **********************************************************************/
+        static real getEntry(int degree, int k, int i);
+
+        /**********************************************************************
+         * Writes the degree + 1 coefficients of the polynomial in t going
+         * through the degree + 1 values in controls, lowest first, to
+         * coefficients. t0 and t1 are the times of the first and last
+         * control point, and t0 must be strictly smaller.
+         * Nothing is allocated unless the degree is above TABLE_DEGREE.
+        **********************************************************************/
+        static void toMonomial(const real* controls, int degree, real t0,
+            real t1, real* coefficients);
+    };
+}
+
+#endif
@@ -17,46 +17,28 @@ BezierCurve::BezierCurve(std::vector<Point>& points, real t0, real t1){
 }
 
 
-// Generate Polynomial function definition
-Polynomial BezierCurve::generatePolynomial(Polynomial& p1, Polynomial& p2) {
-    std::vector<real> vectorTemp{ -t0 / (t1 - t0), 1 / (t1 - t0) };
-    Polynomial first{ vectorTemp };
-    // Note that p1 and p2 can be points as well, not just lines
-    Polynomial second{ p2 - p1 };
-    return (first * second) + p1;
-}
-
-
 // Generate X and Y function defintion
 void BezierCurve::generateXandY(){
-
-    // Resizing the vector
-    x.resize(points.size());
-    y.resize(points.size());
-    for(int i = 0; i < points.size(); i++){
-        x[i].resize(points.size() - i);
-        y[i].resize(points.size() - i);
+    if(points.size() == 0){
+        x = Polynomial();
+        y = Polynomial();
+        return;
     }
 
-    // Generates the degree 0 polynomials (points)
+    int degree = points.size() - 1;
+    std::vector<real> xControls(points.size()), yControls(points.size());
     for(int i = 0; i < points.size(); i++){
-        std::vector<real> xVector{points[i].getX()};
-        std::vector<real> yVector{points[i].getY()};
-
-        Polynomial xPolynomial(xVector);
-        Polynomial yPolynomial(yVector);
-
-        x[0][i] = xPolynomial;
-        y[0][i] = yPolynomial;
+        xControls[i] = points[i].getX();
+        yControls[i] = points[i].getY();
     }
 
-    // Generates the rest of the polynomials
-    for(int i = 1; i < points.size(); i++){
-        for(int j = 0; j < points.size() - i ; j++){
-            x[i][j] = generatePolynomial(x[i-1][j], x[i-1][j+1]);
-            y[i][j] = generatePolynomial(y[i-1][j], y[i-1][j+1]);
-        }
-    }
+    std::vector<real> coefficients(points.size());
+    BernsteinBasis::toMonomial(xControls.data(), degree, t0, t1,
+        coefficients.data());
+    x.setCoefficients(coefficients);
+    BernsteinBasis::toMonomial(yControls.data(), degree, t0, t1,
+        coefficients.data());
+    y.setCoefficients(coefficients);
 }
 
 
@@ -77,8 +59,8 @@ Point BezierCurve::getPoint(int index) const{
 
 // X curve getter function definition
 Polynomial BezierCurve::getX() const{
-    if(x.size() > 0 && x[x.size()-1].size() > 0){
-        return x[x.size() - 1][0];
+    if(points.size() > 0){
+        return x;
     }
     else{
         throw std::out_of_range("The curve is empty");
@@ -88,8 +70,30 @@ Polynomial BezierCurve::getX() const{
 
 // Y curve getter function definition
 Polynomial BezierCurve::getY() const{
-    if(y.size() > 0 && y[y.size()-1].size() > 0){
-        return y[y.size() - 1][0];
+    if(points.size() > 0){
+        return y;
+    }
+    else{
+        throw std::out_of_range("The curve is empty");
+    }
+}
+
+
+// X view getter function definition
+PolynomialView BezierCurve::getXView() const{
+    if(points.size() > 0){
+        return x.getView();
+    }
+    else{
+        throw std::out_of_range("The curve is empty");
+    }
+}
+
+
+// Y view getter function definition
+PolynomialView BezierCurve::getYView() const{
+    if(points.size() > 0){
+        return y.getView();
     }
     else{
         throw std::out_of_range("The curve is empty");
@@ -159,19 +163,50 @@ void BezierCurve::addPoint(const Point& point){
 
 // Integrate function defintion
 ComplexNumber BezierCurve::integrate(real dt, int n) const{
-    
-    real r{0}, i{0};
+    // Views, so that nothing is copied inside the kernel
+    return CurveIntegrator::integrateRiemann(getXView(), getYView(), t0, t1,
+        dt, n);
+}
 
-    // Divides area under curve into rectangles of width dt
-    for(real t = t0; t <= t1; t += dt){
-        r += getX().getValue(t) * cos(2 * PI * t * n) * dt 
-            - getY().getValue(t) * sin(2 * PI * t * n) * dt;
 
-        i += getX().getValue(t) * sin(2 * PI * t * n) * dt
-            + getY().getValue(t) * cos(2 * PI * t * n) * dt;
-    }
-    ComplexNumber result(r, i);
-    return result;
+// Integrate exact function definition
+ComplexNumber BezierCurve::integrateExact(int n) const{
+    return CurveIntegrator::integrateExact(getXView(), getYView(), t0, t1, n);
+}
+
+
+// Integrate Gauss-Legendre function definition
+ComplexNumber BezierCurve::integrateGaussLegendre(real dt, int order,
+    int n) const{
+
+    return CurveIntegrator::integrateGaussLegendre(getXView(), getYView(),
+        t0, t1, dt, order, n);
+}
+
+
+// Integrate adaptive function definition
+ComplexNumber BezierCurve::integrateAdaptive(real tolerance, int n,
+    real& error) const{
+
+    return CurveIntegrator::integrateAdaptive(getXView(), getYView(), t0, t1,
+        tolerance, n, error);
+}
+
+
+// Integrate with method function definition
+ComplexNumber BezierCurve::integrate(real dt, int n,
+    IntegrationMethod method) const{
+
+    return integrate(IntegrationPolicy(method, dt), n);
+}
+
+
+// Integrate with policy function definition
+ComplexNumber BezierCurve::integrate(const IntegrationPolicy& policy,
+    int n) const{
+
+    return CurveIntegrator::integrate(getXView(), getYView(), t0, t1, policy,
+        n);
 }
 
 // Overloaded output operator<< function defintion
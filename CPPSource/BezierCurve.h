@@ -34,6 +34,9 @@
 #include "Point.h"
 #include "Polynomial.h"
 #include "ComplexNumber.h"
+#include "IntegrationPolicy.h"
+#include "BernsteinBasis.h"
+#include "CurveIntegrator.h"
 #include "unit.h"
 
 namespace fs{
@@ -61,18 +64,12 @@ namespace fs{
         std::vector<Point> points;
         
         /**********************************************************************
-         * 2D vectors of polynomials that describe the polynomials that
-         * define the bezier curve. The 2D vector looks like a pyramid,
-         * where the first vector contains m polynomials, the second
-         * contains m - 1 ... etc.
-         * The vectors are generated using the generatePolynomial function,
-         * which starts with every consecutive pair of points (degree 0
-         * polynomials) and generates the first wave of n - 1 lines (degree
-         * 1 polynomials) working its way up to the degree n-1 polynomials,
-         * and so forth.
-        **********************************************************************/
-        std::vector<std::vector<Polynomial>> x;     // x polynomials
-        std::vector<std::vector<Polynomial>> y;     // y polynomials
+         * The x and y polynomials that define the bezier curve.
+         * They are computed straight from the control points by
+         * BernsteinBasis, whenever the points or the time range change.
+        **********************************************************************/
+        Polynomial x;     // x polynomial
+        Polynomial y;     // y polynomial
         
         /**********************************************************************
          * When describing a curve parametrically, we can think of t as a
@@ -90,20 +87,7 @@ namespace fs{
         real t1;    // Input for which x and y match the last control point
 
         /**********************************************************************
-         * Generate n degree polynomial from two (n-1) polynomials.
-         * The function returns a new polynomial.
-         * One way to understand what the newly generated polynomial is to
-         * imagine a point traveling in constant speed from 
-         * t = t0 and t = t1. There is also a second point with the same
-         * attributes traveling over the second. Then imagine a moving
-         * segment attaching the two points. If a third point with the same
-         * constraints travels over this line. The polynomial it draws
-         * is the generated one.  
-        **********************************************************************/
-        Polynomial generatePolynomial(Polynomial& p1, Polynomial& p2);
-
-        /**********************************************************************
-         * Generates the polynomials in the vectors x and y.
+         * Generates the polynomials x and y.
          * Used whenever there is a change in the points.
         **********************************************************************/
         void generateXandY();
@@ -137,20 +121,27 @@ namespace fs{
 
         /**********************************************************************
          * Getter for the x polynomial.
-         * Returns x by vaue to limit user access to the actual polynomial.
-         * Note that only the topmost x polynomial in the 2D vector is
-         * returned. 
+         * Returns x by vaue to limit user access to the actual polynomial. 
         **********************************************************************/ 
         Polynomial getX() const; 
     
         /**********************************************************************
          * Getter for the y polynomial.
-         * Returns y by vaue to limit user access to the actual polynomial.
-         * Note that only the topmost x polynomial in the 2D vector is
-         * returned.  
+         * Returns y by vaue to limit user access to the actual polynomial.  
         **********************************************************************/ 
         Polynomial getY() const;
 
+        /**********************************************************************
+         * Non-owning views of the x and y polynomials.
+         * Unlike getX and getY, these copy nothing, which matters when the
+         * polynomials are evaluated in a loop. The views are only valid
+         * until the curve is modified or destroyed.
+         * Throws an out of range error if the curve is empty.
+        **********************************************************************/
+        PolynomialView getXView() const;
+
+        PolynomialView getYView() const;
+
         real getT0() const;        // Getter for t0
     
         real getT1() const;        // Getter for t1
@@ -201,6 +192,50 @@ namespace fs{
          * Returns a complex number.
         **********************************************************************/
         ComplexNumber integrate(real dt, int n) const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate, but using the closed
+         * form of the integral instead of a sum of rectangles.
+         * If p(t) = x(t) + i * y(t) and a = 2 * pi * i * n, then
+         * repeated integration by parts gives the antiderivative
+         * e^(a * t) * (p(t) / a - p'(t) / a^2 + p''(t) / a^3 - ...),
+         * which ends after degree + 1 terms since p is a polynomial.
+         * When n is 0 the exponential term is 1, and the polynomial is
+         * integrated directly.
+        **********************************************************************/
+        ComplexNumber integrateExact(int n) const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate, by splitting the curve
+         * into the fewest equal sub-intervals no wider than dt, and
+         * applying the Gauss-Legendre rule of the given order to each.
+        **********************************************************************/
+        ComplexNumber integrateGaussLegendre(real dt, int order, int n) const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate, adaptively.
+         * The curve is first split into pieces about 2 turns of the
+         * exponential long, and each piece whose Gauss-Kronrod error
+         * estimate exceeds its share of the tolerance (in proportion to
+         * its width) is halved until it doesn't, or until the estimate is
+         * down to rounding error. The sum of the estimates of the kept
+         * pieces is written to error.
+        **********************************************************************/
+        ComplexNumber integrateAdaptive(real tolerance, int n, real& error)
+            const;
+
+        /**********************************************************************
+         * Integrates the function using the given integration method.
+         * dt is only used by the methods that sample the curve.
+        **********************************************************************/
+        ComplexNumber integrate(real dt, int n, IntegrationMethod method)
+            const;
+
+        /**********************************************************************
+         * Integrates the function using the method and parameters of the
+         * given policy.
+        **********************************************************************/
+        ComplexNumber integrate(const IntegrationPolicy& policy, int n) const;
         
     };
 }
@@ -0,0 +1,123 @@
+/******************************************************************************
+ * BezierCurveN.h
+ * Header file for the BezierCurveN class template, a Bezier curve whose
+ * degree is known at compile time.
+ * It is the counterpart of BezierCurve for the lines, quadratic and cubic
+ * curves that SVG paths are made of. Its polynomials are FixedPolynomials,
+ * so a curve is a small object with no heap memory, and the loops of its
+ * integration methods are unrolled by the compiler.
+ * Being a template, the whole class is defined in this header.
+******************************************************************************/
+
+#ifndef BEZIER_CURVE_N_H
+#define BEZIER_CURVE_N_H
+
+#include <stdexcept>
+#include "FixedPolynomial.h"
+#include "BernsteinBasis.h"
+#include "ComplexNumber.h"
+#include "IntegrationPolicy.h"
+#include "CurveIntegrator.h"
+#include "unit.h"
+
+namespace fs{
+
+    /**************************************************************************
+     * BezierCurveN class template definition.
+     * N is the degree of the curve, so it has N + 1 control points. Only
+     * the polynomials and the time range are kept, not the points.
+    **************************************************************************/
+    template<int N>
+    class BezierCurveN{
+    private:
+
+        FixedPolynomial<N> x;   // x polynomial
+        FixedPolynomial<N> y;   // y polynomial
+
+        real t0;    // Input for which x and y match the first control point
+        real t1;    // Input for which x and y match the last control point
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the x and y parts of the N + 1
+         * control points and the time range.
+         * t0 must be strictly smaller than t1, or an invalid argument error
+         * is thrown.
+        **********************************************************************/
+        BezierCurveN(const real* xControls, const real* yControls, real t0,
+            real t1) : t0{t0}, t1{t1} {
+            if(t0 >= t1){
+                throw std::invalid_argument(
+                    "t0 must be strictly smaller than t1");
+            }
+            real coefficients[N + 1];
+            BernsteinBasis::toMonomial(xControls, N, t0, t1, coefficients);
+            x = FixedPolynomial<N>(coefficients);
+            BernsteinBasis::toMonomial(yControls, N, t0, t1, coefficients);
+            y = FixedPolynomial<N>(coefficients);
+        }
+
+        /**********************************************************************
+         * Argumented constructor, takes polynomials that were already
+         * computed for the time range.
+        **********************************************************************/
+        BezierCurveN(const FixedPolynomial<N>& x, const FixedPolynomial<N>& y,
+            real t0, real t1) : x{x}, y{y}, t0{t0}, t1{t1} {}
+
+        const FixedPolynomial<N>& getX() const{    // Getter for x
+            return x;
+        }
+
+        const FixedPolynomial<N>& getY() const{    // Getter for y
+            return y;
+        }
+
+        real getT0() const{     // Getter for t0
+            return t0;
+        }
+
+        real getT1() const{     // Getter for t1
+            return t1;
+        }
+
+        /**********************************************************************
+         * Integrates (x(t) + i * y(t)) * e^(2 * pi * i * n * t) from t0 to
+         * t1 with its closed form, like BezierCurve::integrateExact, but
+         * with the loops over the fixed polynomials unrolled.
+        **********************************************************************/
+        ComplexNumber integrateExact(int n) const{
+            return CurveIntegrator::integrateExact(x, y, t0, t1, n);
+        }
+
+        /**********************************************************************
+         * Integrates the same function with the Gauss-Legendre rule of the
+         * given order, like BezierCurve::integrateGaussLegendre.
+        **********************************************************************/
+        ComplexNumber integrateGaussLegendre(real dt, int order, int n) const{
+            return CurveIntegrator::integrateGaussLegendre(x, y, t0, t1, dt,
+                order, n);
+        }
+
+        /**********************************************************************
+         * Integrates using the method and parameters of the policy.
+         * The methods that run through batched or adaptive kernels are
+         * handed to CurveIntegrator with views of the polynomials, the
+         * others with the fixed polynomials themselves.
+        **********************************************************************/
+        ComplexNumber integrate(const IntegrationPolicy& policy, int n) const{
+            switch(policy.getMethod()){
+                case IntegrationMethod::EXACT:
+                    return integrateExact(n);
+                case IntegrationMethod::GAUSS_LEGENDRE:
+                    return integrateGaussLegendre(policy.getDt(),
+                        policy.getOrder(), n);
+                default:
+                    return CurveIntegrator::integrate(x.getView(),
+                        y.getView(), t0, t1, policy, n);
+            }
+        }
+    };
+}
+
+#endif
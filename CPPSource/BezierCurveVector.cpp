@@ -7,17 +7,100 @@
 using namespace fs;
 
 // No arg constructor definition
-BezierCurveVector::BezierCurveVector() : interval{1} {}
+BezierCurveVector::BezierCurveVector() : pointOffsets{0}, interval{1} {}
 
 // Argumented constructor definition
-BezierCurveVector::BezierCurveVector(real interval) : interval{interval} {}
+BezierCurveVector::BezierCurveVector(real interval) 
+    : pointOffsets{0}, interval{interval} {}
+
+// getPointNumber function definition
+int BezierCurveVector::getPointNumber(int curve) const{
+    return pointOffsets[curve + 1] - pointOffsets[curve];
+}
+
+// getDegree function definition
+int BezierCurveVector::getDegree(int curve) const{
+    return getPointNumber(curve) - 1;
+}
+
+// getT0 function definition
+real BezierCurveVector::getT0(int curve) const{
+    return curve * interval;
+}
+
+// getXView function definition
+PolynomialView BezierCurveVector::getXView(int curve) const{
+    int degree = getDegree(curve);
+    return PolynomialView(groups[degree].x.data() 
+        + slots[curve] * (degree + 1), degree);
+}
+
+// getYView function definition
+PolynomialView BezierCurveVector::getYView(int curve) const{
+    int degree = getDegree(curve);
+    return PolynomialView(groups[degree].y.data() 
+        + slots[curve] * (degree + 1), degree);
+}
+
+// generateCoefficients function definition
+void BezierCurveVector::generateCoefficients(int curve){
+    int degree = getDegree(curve);
+    if(groups.size() <= degree){
+        groups.resize(degree + 1);
+    }
+    DegreeGroup& group = groups[degree];
+
+    // A new curve, or one of a new degree, takes the next slot of its group
+    if(slots.size() <= curve){
+        slots.push_back(-1);
+    }
+    if(slots[curve] < 0){
+        slots[curve] = group.curves.size();
+        group.curves.push_back(curve);
+        group.x.resize(group.x.size() + degree + 1);
+        group.y.resize(group.y.size() + degree + 1);
+    }
+
+    int offset = slots[curve] * (degree + 1);
+    BernsteinBasis::toMonomial(controlX.data() + pointOffsets[curve], degree,
+        getT0(curve), getT0(curve + 1), group.x.data() + offset);
+    BernsteinBasis::toMonomial(controlY.data() + pointOffsets[curve], degree,
+        getT0(curve), getT0(curve + 1), group.y.data() + offset);
+}
+
+// removeSlot function definition
+void BezierCurveVector::removeSlot(int curve){
+    int degree = getDegree(curve);
+    DegreeGroup& group = groups[degree];
+    int slot = slots[curve];
+    int last = group.curves.size() - 1;
+
+    if(slot != last){
+        int moved = group.curves[last];
+        group.curves[slot] = moved;
+        slots[moved] = slot;
+        std::copy_n(group.x.begin() + last * (degree + 1), degree + 1,
+            group.x.begin() + slot * (degree + 1));
+        std::copy_n(group.y.begin() + last * (degree + 1), degree + 1,
+            group.y.begin() + slot * (degree + 1));
+    }
+    group.curves.pop_back();
+    group.x.resize(last * (degree + 1));
+    group.y.resize(last * (degree + 1));
+    slots[curve] = -1;
+}
 
 // getBezierCurve function definition
 BezierCurve BezierCurveVector::getBezierCurve(int index) const{
-    if(index < 0 || index >= bezierCurveVector.size()){
+    if(index < 0 || index >= getBezierCurveNumber()){
         throw std::invalid_argument("The index does not exist");
     }
-    return bezierCurveVector[index];
+    std::vector<Point> points;
+    points.reserve(getPointNumber(index));
+    for(int i = pointOffsets[index]; i < pointOffsets[index + 1]; i++){
+        points.push_back(Point(controlX[i], controlY[i]));
+    }
+    return BezierCurve(points, getT0(index), getT0(index + 1));
 }
 
 // getInterval function definition
@@ -27,55 +110,106 @@ real BezierCurveVector::getInterval() const{
 
 // getBezierCurveNumber function defintion
 int BezierCurveVector::getBezierCurveNumber() const{
-    return bezierCurveVector.size();
+    return pointOffsets.size() - 1;
 }
 
-// addBezierCurve function defintion
-void BezierCurveVector::addBezierCurve(const BezierCurve& bezierCurve){
-    // If the curve is empty, it isn't added
-    if(bezierCurve.getPointNumber() == 0){
-        std::cerr << "Cannot add empty Bezier Curve\n";
+// getPoint function definition
+Point BezierCurveVector::getPoint(int curve, int index) const{
+    if(curve < 0 || curve >= getBezierCurveNumber()
+        || index < 0 || index >= getPointNumber(curve)){
+        throw std::out_of_range("The point does not exist");
     }
-    // If the vector is empty, then addition is automatic
-    else if(bezierCurveVector.size() == 0){
-        BezierCurve newCurve{bezierCurve};
-        newCurve.setTimeParameters(0, interval);
-        bezierCurveVector.push_back(newCurve);
-    }
-    // If the last point in the vector matches the first point in the argument
-    else if(bezierCurve.getPoint(0) == 
-        bezierCurveVector[getBezierCurveNumber() - 1]
-        .getPoint(bezierCurveVector[getBezierCurveNumber() - 1]
-        .getPointNumber())){
-        BezierCurve newCurve{bezierCurve};
-        real startPoint = getBezierCurveNumber() * interval;
-        newCurve.setTimeParameters(startPoint, startPoint + interval);
-        bezierCurveVector.push_back(newCurve);
+    int i = pointOffsets[curve] + index;
+    return Point(controlX[i], controlY[i]);
+}
+
+// setPoint function definition
+void BezierCurveVector::setPoint(int curve, int index, const Point& point){
+    if(curve < 0 || curve >= getBezierCurveNumber()
+        || index < 0 || index >= getPointNumber(curve)){
+        throw std::out_of_range("The point does not exist");
     }
-    // Else we can't push the BezierCurve
-    else{
-         std::cerr << "Cannot add discontinuous Bezier Curve\n";
+    int i = pointOffsets[curve] + index;
+    controlX[i] = point.getX();
+    controlY[i] = point.getY();
+    generateCoefficients(curve);
+}
+
+// setPoints function definition
+void BezierCurveVector::setPoints(int curve, const Point* points, int count){
+    if(curve < 0 || curve >= getBezierCurveNumber()){
+        throw std::out_of_range("The curve does not exist");
+    }
+    if(count <= 0){
+        throw std::invalid_argument("A curve must have at least one point");
     }
+
+    /**************************************************************************
+     * A curve of another degree leaves its group, and the points of the
+     * curves after it are shifted to make room for its new points.
+    **************************************************************************/
+    int difference = count - getPointNumber(curve);
+    if(difference != 0){
+        removeSlot(curve);
+        int end = pointOffsets[curve + 1];
+        if(difference > 0){
+            controlX.insert(controlX.begin() + end, difference, 0);
+            controlY.insert(controlY.begin() + end, difference, 0);
+        }
+        else{
+            controlX.erase(controlX.begin() + end + difference,
+                controlX.begin() + end);
+            controlY.erase(controlY.begin() + end + difference,
+                controlY.begin() + end);
+        }
+        for(int i = curve + 1; i < pointOffsets.size(); i++){
+            pointOffsets[i] += difference;
+        }
+    }
+
+    for(int i = 0; i < count; i++){
+        controlX[pointOffsets[curve] + i] = points[i].getX();
+        controlY[pointOffsets[curve] + i] = points[i].getY();
+    }
+    generateCoefficients(curve);
+}
+
+// getDuration function definition
+real BezierCurveVector::getDuration() const{
+    return getBezierCurveNumber() * interval;
+}
+
+// addBezierCurve function defintion
+void BezierCurveVector::addBezierCurve(const BezierCurve& bezierCurve){
+    // Only the control points are kept, the time range is set by the index
+    std::vector<Point> points;
+    for(int i = 0; i < bezierCurve.getPointNumber(); i++){
+        points.push_back(bezierCurve.getPoint(i));
+    }
+    addBezierCurve(points);
 }
 
 void BezierCurveVector::addBezierCurve(std::vector<Point>& points){
+    addBezierCurve(points.data(), points.size());
+}
+
+void BezierCurveVector::addBezierCurve(const Point* points, int count){
     // If the curve is empty, it isn't added
-    if(points.size() == 0){
+    if(count == 0){
         std::cerr << "Cannot add empty Bezier Curve\n";
     }
-    // If the vector is empty, then addition is automatic
-    else if(bezierCurveVector.size() == 0){
-        BezierCurve curve(points, 0, interval);
-        bezierCurveVector.push_back(curve);
-    }
-    // If the last point in the vector matches the first point in the argument
-    else if(points[0] == 
-        bezierCurveVector[getBezierCurveNumber() - 1]
-        .getPoint(bezierCurveVector[getBezierCurveNumber() - 1]
-        .getPointNumber() - 1)){
-        real startPoint = getBezierCurveNumber() * interval;
-        BezierCurve curve(points, startPoint, (startPoint + interval));
-        bezierCurveVector.push_back(curve);
+    /**************************************************************************
+     * If the vector is empty, then addition is automatic, otherwise the 
+     * last point in the vector must match the first point in the argument.
+    **************************************************************************/
+    else if(controlX.size() == 0 || (points[0].getX() == controlX.back()
+        && points[0].getY() == controlY.back())){
+        for(int i = 0; i < count; i++){
+            controlX.push_back(points[i].getX());
+            controlY.push_back(points[i].getY());
+        }
+        pointOffsets.push_back(controlX.size());
+        generateCoefficients(getBezierCurveNumber() - 1);
     }
     // Else we can't push the BezierCurve
     else{
@@ -87,10 +221,9 @@ void BezierCurveVector::addBezierCurve(std::vector<Point>& points){
 void BezierCurveVector::setInterval(real interval){
     if(interval > 0){
         this->interval = interval;
+        // The time ranges change, and so do the polynomials
         for(int i = 0; i < getBezierCurveNumber(); i++){
-            // The curves automatically update their parametric functions
-            bezierCurveVector[i].setTimeParameters(i * interval, 
-                (i+1) * interval);
+            generateCoefficients(i);
         }
     } else {
         std::cerr 
@@ -99,18 +232,325 @@ void BezierCurveVector::setInterval(real interval){
 }
 
 
+// Sample function definition
+std::vector<ComplexNumber> BezierCurveVector::sample(int count) const{
+    if(getBezierCurveNumber() == 0){
+        throw std::out_of_range("The vector is empty");
+    }
+
+    std::vector<ComplexNumber> samples(count);
+    real duration = getDuration();
+
+    std::vector<real> times(count), xValues(count), yValues(count);
+    for(int j = 0; j < count; j++){
+        times[j] = j * duration / count;
+    }
+
+    /**************************************************************************
+     * The times are increasing, so each curve covers a contiguous run of
+     * them, which is evaluated in one batch.
+    **************************************************************************/
+    int start = 0;
+    for(int curve = 0; curve < getBezierCurveNumber(); curve++){
+        int end = start;
+        bool last = (curve == getBezierCurveNumber() - 1);
+        while(end < count 
+            && (last || times[end] < getT0(curve + 1))){
+            end++;
+        }
+
+        SimdKernels::evaluate(getXView(curve),
+            times.data() + start, xValues.data() + start, end - start);
+        SimdKernels::evaluate(getYView(curve),
+            times.data() + start, yValues.data() + start, end - start);
+        start = end;
+    }
+
+    for(int j = 0; j < count; j++){
+        samples[j] = ComplexNumber(xValues[j], yValues[j]);
+    }
+    return samples;
+}
+
+
 // Integrate function definition
 ComplexNumber BezierCurveVector::integrate(real dt, int n) const{
+    return integrate(dt, n, IntegrationMethod::RIEMANN_SUM);
+}
+
+// Integrate with method function definition
+ComplexNumber BezierCurveVector::integrate(real dt, int n,
+    IntegrationMethod method) const{
+    return integrate(IntegrationPolicy(method, dt), n);
+}
+
+// Integrate with policy function definition
+ComplexNumber BezierCurveVector::integrate(const IntegrationPolicy& policy,
+    int n) const{
+    // The tolerance is shared between the curves
+    if(policy.getMethod() == IntegrationMethod::ADAPTIVE){
+        real error;
+        return integrateAdaptive(policy.getTolerance(), n, error);
+    }
+
+    /**************************************************************************
+     * Note that because the vector handles the time parameters of the 
+     * curves according to an interval, there is no need to change anything
+     * here. If we want the integration to be between 0 and 1 for the total,
+     * we can set the interval to 1/n, instead of sending n/size here.
+    **************************************************************************/
+    ComplexNumber result{};
+    for(int degree = 0; degree < groups.size(); degree++){
+        // The degrees of SVG curves are dispatched at compile time
+        switch(degree){
+            case 1:
+                result += integrateGroup<1>(policy, n);
+                continue;
+            case 2:
+                result += integrateGroup<2>(policy, n);
+                continue;
+            case 3:
+                result += integrateGroup<3>(policy, n);
+                continue;
+        }
+
+        const DegreeGroup& group = groups[degree];
+        for(int slot = 0; slot < group.curves.size(); slot++){
+            int curve = group.curves[slot];
+            PolynomialView x(group.x.data() + slot * (degree + 1), degree);
+            PolynomialView y(group.y.data() + slot * (degree + 1), degree);
+            result += CurveIntegrator::integrate(x, y, getT0(curve),
+                getT0(curve + 1), policy, n);
+        }
+    }
+    return result;
+}
+
+// Integrate group function definition
+template<int N>
+ComplexNumber BezierCurveVector::integrateGroup(
+    const IntegrationPolicy& policy, int n) const{
+
+    const DegreeGroup& group = groups[N];
     ComplexNumber result{};
-    for(int i = 0; i < bezierCurveVector.size(); i++){
-        /**********************************************************************
-         * Note that because the curve handles setting the time parameters
-         * of the curves according to an interval, there is no need
-         * to change anything here. If we want the integration to be 
-         * between 0 and 1 for the total, we can set the interval to 
-         * 1/n, instead of sending n/size here.
-        **********************************************************************/
-        result += bezierCurveVector[i].integrate(dt, n);
+    for(int slot = 0; slot < group.curves.size(); slot++){
+        result += integrateFixed<N>(group.curves[slot], policy, n);
+    }
+    return result;
+}
+
+// Integrate fixed function definition
+template<int N>
+ComplexNumber BezierCurveVector::integrateFixed(int curve,
+    const IntegrationPolicy& policy, int n) const{
+
+    const DegreeGroup& group = groups[N];
+    int offset = slots[curve] * (N + 1);
+    BezierCurveN<N> bezierCurve(FixedPolynomial<N>(group.x.data() + offset),
+        FixedPolynomial<N>(group.y.data() + offset), getT0(curve),
+        getT0(curve + 1));
+    return bezierCurve.integrate(policy, n);
+}
+
+// Integrate curve function definition
+ComplexNumber BezierCurveVector::integrateCurve(int curve,
+    const IntegrationPolicy& policy, int n) const{
+
+    switch(getDegree(curve)){
+        case 1:
+            return integrateFixed<1>(curve, policy, n);
+        case 2:
+            return integrateFixed<2>(curve, policy, n);
+        case 3:
+            return integrateFixed<3>(curve, policy, n);
+    }
+    return CurveIntegrator::integrate(getXView(curve), getYView(curve),
+        getT0(curve), getT0(curve + 1), policy, n);
+}
+
+// Integrate adaptive function definition
+ComplexNumber BezierCurveVector::integrateAdaptive(real tolerance, int n,
+    real& error) const{
+    ComplexNumber result{};
+    error = 0;
+
+    // All the curves have the same interval, so they share it equally
+    real share = tolerance / std::max(1, getBezierCurveNumber());
+    for(int degree = 0; degree < groups.size(); degree++){
+        const DegreeGroup& group = groups[degree];
+        for(int slot = 0; slot < group.curves.size(); slot++){
+            int curve = group.curves[slot];
+            PolynomialView x(group.x.data() + slot * (degree + 1), degree);
+            PolynomialView y(group.y.data() + slot * (degree + 1), degree);
+            real curveError;
+            result += CurveIntegrator::integrateAdaptive(x, y, getT0(curve),
+                getT0(curve + 1), share, n, curveError);
+            error += curveError;
+        }
+    }
+    return result;
+}
+
+// Accumulate function definition
+template<class P>
+void BezierCurveVector::accumulate(const P& x, const P& y, real t0, real t1,
+    real dt, FrequencySums& sums){
+
+    // Number of samples after which the phasors are put back on the circle
+    const int renormalizationPeriod = 64;
+
+    int count = sums.sumR.size();
+    real* sumR = sums.sumR.data();
+    real* sumI = sums.sumI.data();
+    real* phasorR = sums.phasorR.data();
+    real* phasorI = sums.phasorI.data();
+    const real* rotorR = sums.rotorR.data();
+    const real* rotorI = sums.rotorI.data();
+
+    // The phasors are restarted exactly at the start of each curve
+    for(int j = 0; j < count; j++){
+        phasorR[j] = cos(2 * PI * (sums.nMin + j) * t0);
+        phasorI[j] = sin(2 * PI * (sums.nMin + j) * t0);
+    }
+
+    // Same samples as the rectangles of BezierCurve::integrate
+    int samples = CurveIntegrator::getSampleCount(t0, t1, dt);
+    for(int s = 0; s < samples; s++){
+        real t = t0 + s * dt;
+        real xValue = x.getValue(t);
+        real yValue = y.getValue(t);
+
+        for(int j = 0; j < count; j++){
+            sumR[j] += xValue * phasorR[j] - yValue * phasorI[j];
+            sumI[j] += xValue * phasorI[j] + yValue * phasorR[j];
+
+            real r = phasorR[j] * rotorR[j] - phasorI[j] * rotorI[j];
+            phasorI[j] = phasorR[j] * rotorI[j] + phasorI[j] * rotorR[j];
+            phasorR[j] = r;
+        }
+
+        if((s + 1) % renormalizationPeriod == 0){
+            for(int j = 0; j < count; j++){
+                real magnitude = std::sqrt(phasorR[j] * phasorR[j] 
+                    + phasorI[j] * phasorI[j]);
+                phasorR[j] /= magnitude;
+                phasorI[j] /= magnitude;
+            }
+        }
+    }
+}
+
+// Accumulate group function definition
+template<int N>
+void BezierCurveVector::accumulateGroup(real dt, int firstCurve,
+    int endCurve, FrequencySums& sums) const{
+
+    const DegreeGroup& group = groups[N];
+    for(int slot = 0; slot < group.curves.size(); slot++){
+        int curve = group.curves[slot];
+        if(curve < firstCurve || curve >= endCurve){
+            continue;
+        }
+        accumulate(FixedPolynomial<N>(group.x.data() + slot * (N + 1)),
+            FixedPolynomial<N>(group.y.data() + slot * (N + 1)),
+            getT0(curve), getT0(curve + 1), dt, sums);
+    }
+}
+
+// Integrate batch function definition
+std::vector<ComplexNumber> BezierCurveVector::integrateBatch(real dt,
+    int nMin, int nMax, int firstCurve, int endCurve) const{
+
+    int count = std::max(0, nMax - nMin + 1);
+
+    FrequencySums sums;
+    sums.nMin = nMin;
+    sums.sumR.assign(count, 0);
+    sums.sumI.assign(count, 0);
+    sums.phasorR.assign(count, 0);
+    sums.phasorI.assign(count, 0);
+    sums.rotorR.resize(count);
+    sums.rotorI.resize(count);
+    for(int j = 0; j < count; j++){
+        sums.rotorR[j] = cos(2 * PI * (nMin + j) * dt);
+        sums.rotorI[j] = sin(2 * PI * (nMin + j) * dt);
+    }
+
+    for(int degree = 0; degree < groups.size(); degree++){
+        switch(degree){
+            case 1:
+                accumulateGroup<1>(dt, firstCurve, endCurve, sums);
+                continue;
+            case 2:
+                accumulateGroup<2>(dt, firstCurve, endCurve, sums);
+                continue;
+            case 3:
+                accumulateGroup<3>(dt, firstCurve, endCurve, sums);
+                continue;
+        }
+
+        const DegreeGroup& group = groups[degree];
+        for(int slot = 0; slot < group.curves.size(); slot++){
+            int curve = group.curves[slot];
+            if(curve < firstCurve || curve >= endCurve){
+                continue;
+            }
+            accumulate(
+                PolynomialView(group.x.data() + slot * (degree + 1), degree),
+                PolynomialView(group.y.data() + slot * (degree + 1), degree),
+                getT0(curve), getT0(curve + 1), dt, sums);
+        }
+    }
+
+    std::vector<ComplexNumber> result(count);
+    for(int j = 0; j < count; j++){
+        result[j] = ComplexNumber(sums.sumR[j] * dt, sums.sumI[j] * dt);
+    }
+    return result;
+}
+
+// Integrate all function definition
+std::vector<ComplexNumber> BezierCurveVector::integrateAll(real dt, int nMin,
+    int nMax) const{
+
+    std::vector<ComplexNumber> result(std::max(0, nMax - nMin + 1));
+    int curves = getBezierCurveNumber();
+    for(int first = 0; first < curves; first += CURVES_PER_BATCH){
+        std::vector<ComplexNumber> batch = integrateBatch(dt, nMin, nMax,
+            first, std::min(curves, first + CURVES_PER_BATCH));
+        for(int j = 0; j < result.size(); j++){
+            result[j] += batch[j];
+        }
+    }
+    return result;
+}
+
+// Integrate all with pool function definition
+std::vector<ComplexNumber> BezierCurveVector::integrateAll(real dt, int nMin,
+    int nMax, ThreadPool& pool) const{
+
+    /**************************************************************************
+     * Every batch covers all the frequencies over its own curves, so no
+     * sample is evaluated twice, and the batches are added in the same
+     * order as by the serial function.
+    **************************************************************************/
+    int curves = getBezierCurveNumber();
+    int batches = (curves + CURVES_PER_BATCH - 1) / CURVES_PER_BATCH;
+    std::vector<std::vector<ComplexNumber>> parts(batches);
+    for(int batch = 0; batch < batches; batch++){
+        pool.submit([this, &parts, dt, nMin, nMax, curves, batch]{
+            int first = batch * CURVES_PER_BATCH;
+            parts[batch] = integrateBatch(dt, nMin, nMax, first,
+                std::min(curves, first + CURVES_PER_BATCH));
+        });
+    }
+    pool.wait();
+
+    std::vector<ComplexNumber> result(std::max(0, nMax - nMin + 1));
+    for(const std::vector<ComplexNumber>& part : parts){
+        for(int j = 0; j < result.size(); j++){
+            result[j] += part[j];
+        }
     }
     return result;
 }
@@ -16,9 +16,17 @@
 #include <iostream>
 #include <math.h>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
 #include "Point.h"
 #include "BezierCurve.h"
+#include "Polynomial.h"
+#include "BernsteinBasis.h"
+#include "FixedPolynomial.h"
+#include "BezierCurveN.h"
 #include "ComplexNumber.h"
+#include "CurveIntegrator.h"
+#include "ThreadPool.h"
 #include "unit.h"
 
 namespace fs{
@@ -32,17 +40,130 @@ namespace fs{
     class BezierCurveVector{
     private:
 
-        // Vector holding connected Bezier Curves
-        std::vector<BezierCurve> bezierCurveVector;
+        /**********************************************************************
+         * Coefficients of all the curves of one degree, packed back to back.
+         * The x and y polynomials of the curve at slot s of the group start
+         * at index s * (degree + 1) of x and y.
+        **********************************************************************/
+        struct DegreeGroup{
+            std::vector<int> curves;    // Index of the curve at each slot
+            std::vector<real> x;        // x coefficients, lowest first
+            std::vector<real> y;        // y coefficients, lowest first
+        };
+
+        /**********************************************************************
+         * Control points of all the curves in order, the x and y parts kept
+         * in separate arrays. The points of curve i are those from index
+         * pointOffsets[i] up to pointOffsets[i + 1], so pointOffsets always
+         * holds one more element than there are curves.
+        **********************************************************************/
+        std::vector<real> controlX;
+        std::vector<real> controlY;
+        std::vector<int> pointOffsets;
+
+        /**********************************************************************
+         * Groups of curves, indexed by degree, and the slot each curve has
+         * in its group. The curves are grouped so that the kernels stream
+         * through arrays of one stride, instead of visiting a separately
+         * allocated BezierCurve per curve.
+        **********************************************************************/
+        std::vector<DegreeGroup> groups;
+        std::vector<int> slots;
 
         /********************************************************************** 
          * Interval of time for which each BezierCurve is defined.
          * For example, if interval is 1, then the first Bezier Curve.
          * would be defined from t = 0 to t = 1, and the second from t = 1 to
-         * t = 2 etc...
+         * t = 2 etc... So the time range of a curve follows from its index.
         **********************************************************************/
         real interval; 
 
+        // Degree of a curve, which is its number of points minus 1
+        int getDegree(int curve) const;
+
+        // Time at which a curve starts, and the next one ends
+        real getT0(int curve) const;
+
+        /**********************************************************************
+         * Views of the x and y polynomials of a curve, inside its group.
+         * They are only valid until the vector is modified.
+        **********************************************************************/
+        PolynomialView getXView(int curve) const;
+
+        PolynomialView getYView(int curve) const;
+
+        /**********************************************************************
+         * Computes the polynomials of a curve from its control points and
+         * time range, and writes them to the curve's slot, adding the slot
+         * to its group if it doesn't exist yet.
+        **********************************************************************/
+        void generateCoefficients(int curve);
+
+        /**********************************************************************
+         * Takes a curve out of its group, moving the curve of the group's
+         * last slot into the one it frees, so that the slots stay packed.
+        **********************************************************************/
+        void removeSlot(int curve);
+
+        /**********************************************************************
+         * Integrates a curve of degree N with a BezierCurveN, so that the
+         * loops over its coefficients are unrolled.
+        **********************************************************************/
+        template<int N>
+        ComplexNumber integrateFixed(int curve,
+            const IntegrationPolicy& policy, int n) const;
+
+        /**********************************************************************
+         * Running sums of integrateAll, with the phasors
+         * e^(2 * pi * i * n * t) and rotors e^(2 * pi * i * n * dt) of all
+         * the frequencies from nMin on, kept in separate real arrays so
+         * that the inner loop is a plain multiply-add over them.
+        **********************************************************************/
+        struct FrequencySums{
+            int nMin;
+            std::vector<real> sumR, sumI;
+            std::vector<real> phasorR, phasorI;
+            std::vector<real> rotorR, rotorI;
+        };
+
+        /**********************************************************************
+         * Adds the rectangles of width dt of one curve to the sums.
+         * P is PolynomialView, or a FixedPolynomial for the degrees that
+         * are dispatched at compile time.
+        **********************************************************************/
+        template<class P>
+        static void accumulate(const P& x, const P& y, real t0, real t1,
+            real dt, FrequencySums& sums);
+
+        /**********************************************************************
+         * Versions of the integrate and integrateAll loops over the group
+         * of curves of degree N, which build a BezierCurveN or a
+         * FixedPolynomial per curve instead of using views, so that the
+         * loops over the coefficients are unrolled.
+         * The group must exist.
+        **********************************************************************/
+        template<int N>
+        ComplexNumber integrateGroup(const IntegrationPolicy& policy, int n)
+            const;
+
+        template<int N>
+        void accumulateGroup(real dt, int firstCurve, int endCurve,
+            FrequencySums& sums) const;
+
+        /**********************************************************************
+         * Curves whose sums integrateAll keeps apart, so that the batches
+         * can be integrated on different threads, and added up in the
+         * same order whatever the number of threads.
+        **********************************************************************/
+        static constexpr int CURVES_PER_BATCH = 16;
+
+        /**********************************************************************
+         * Integrates the curves from firstCurve to endCurve - 1 the way
+         * integrateAll does, and returns their part of the integrals.
+        **********************************************************************/
+        std::vector<ComplexNumber> integrateBatch(real dt, int nMin, int nMax,
+            int firstCurve, int endCurve) const;
+
     public:
 
         // No arg constructor, sets interval to 1 and keeps the vector empty
@@ -54,7 +175,8 @@ namespace fs{
         /**********************************************************************
          * Returns the Bezier Curve by value at a specific index.
          * It is returned by value to avoid allowing the Bezier Curve to 
-         * be changed after it has been placed.
+         * be changed after it has been placed. The vector doesn't store
+         * BezierCurve objects, so it is rebuilt from the control points.
          * The index must be whithin the range of Existing Bezier Curves.
         **********************************************************************/
         BezierCurve getBezierCurve(int index) const;
@@ -62,6 +184,35 @@ namespace fs{
         // getBezierCurveNumber returns the number of Bezier Curves
         int getBezierCurveNumber() const;
 
+        // Number of control points of a curve, which must exist
+        int getPointNumber(int curve) const;
+
+        /**********************************************************************
+         * Returns a control point of a curve, without building the curve.
+         * Throws an out of range error if the point doesn't exist.
+        **********************************************************************/
+        Point getPoint(int curve, int index) const;
+
+        /**********************************************************************
+         * Moves a control point of a curve, and rewrites the curve's
+         * coefficients in its slot, which allocates nothing.
+         * Unlike addBezierCurve, this doesn't keep the curves connected:
+         * moving an end point leaves it to the caller to move the point of
+         * the neighbouring curve too.
+         * Throws an out of range error if the point doesn't exist.
+        **********************************************************************/
+        void setPoint(int curve, int index, const Point& point);
+
+        /**********************************************************************
+         * Replaces the count control points of a curve, with the same rules
+         * as setPoint. The curve keeps its slot if its number of points
+         * doesn't change, otherwise it moves to the group of its new
+         * degree, which allocates.
+         * Throws an out of range error if the curve doesn't exist, and an
+         * invalid argument error if there are no points.
+        **********************************************************************/
+        void setPoints(int curve, const Point* points, int count);
+
         // getInterval, returns the time interval
         real getInterval() const;
 
@@ -88,6 +239,51 @@ namespace fs{
         **********************************************************************/
         void addBezierCurve(std::vector<Point>& points);
 
+        /**********************************************************************
+         * Same as the function above, for count points stored one after the
+         * other, such as a curve of a PathPoints.
+        **********************************************************************/
+        void addBezierCurve(const Point* points, int count);
+
+        /**********************************************************************
+         * Returns the total time the curves are defined over, which is
+         * the number of curves times the interval.
+        **********************************************************************/
+        real getDuration() const;
+
+        /**********************************************************************
+         * Samples the piece-wise function at count evenly spaced times
+         * t = j * duration / count for j = 0 to count - 1, and returns the
+         * values as complex numbers x(t) + i * y(t).
+         * The vector must not be empty.
+        **********************************************************************/
+        std::vector<ComplexNumber> sample(int count) const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate(dt, n) for every n
+         * from nMin to nMax in a single pass, and returns the results in
+         * that order.
+         * Each sample of x(t) and y(t) is evaluated once and accumulated
+         * into all the frequencies. Instead of calling sin and cos per
+         * sample, e^(2 * pi * i * n * t) is advanced from one sample to
+         * the next by multiplying it with e^(2 * pi * i * n * dt). The
+         * product slowly drifts off the unit circle, so it is renormalized
+         * periodically, and restarted exactly at the start of each curve.
+         * The curves are summed in batches of CURVES_PER_BATCH, which are
+         * then added together in order.
+        **********************************************************************/
+        std::vector<ComplexNumber> integrateAll(real dt, int nMin, int nMax)
+            const;
+
+        /**********************************************************************
+         * Returns the same integrals as the function above, computing the
+         * batches of curves concurrently on the pool. Each sample is still
+         * only evaluated once, and the result is the same as the serial
+         * one, whatever the number of workers.
+        **********************************************************************/
+        std::vector<ComplexNumber> integrateAll(real dt, int nMin, int nMax,
+            ThreadPool& pool) const;
+
         // Interval setter, recalculates each Bezier Curve. Muts be positive.
         void setInterval(real interval);
 
@@ -110,6 +306,38 @@ namespace fs{
         **********************************************************************/
         ComplexNumber integrate(real dt, int n) const;
 
+        /**********************************************************************
+         * Integrates the same function as integrate, but lets the caller
+         * choose the integration method used on each Bezier Curve.
+         * With IntegrationMethod::EXACT, dt is ignored.
+        **********************************************************************/
+        ComplexNumber integrate(real dt, int n, IntegrationMethod method)
+            const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate, using the method and
+         * parameters of the given policy on each Bezier Curve.
+        **********************************************************************/
+        ComplexNumber integrate(const IntegrationPolicy& policy, int n) const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate, over a single curve,
+         * with the method and parameters of the given policy. The curve
+         * is integrated from its slot, so no allocation is made.
+         * The curve must exist.
+        **********************************************************************/
+        ComplexNumber integrateCurve(int curve,
+            const IntegrationPolicy& policy, int n) const;
+
+        /**********************************************************************
+         * Integrates the same function as integrate, adaptively, to within
+         * an absolute error of tolerance. Each Bezier Curve gets a share of
+         * the tolerance in proportion to its interval, and the sum of their
+         * error estimates is written to error.
+        **********************************************************************/
+        ComplexNumber integrateAdaptive(real tolerance, int n, real& error)
+            const;
+
     };
 }
 
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Source file for the CircleGenerator class member functions.
+******************************************************************************/
+
+#include "CircleGenerator.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+CircleGenerator::CircleGenerator(const BezierCurveVector& h,
+    const IntegrationPolicy& policy) : h{h}, policy{policy} {}
+
+
+// Extend function definition
+const std::vector<ComplexNumber>& CircleGenerator::extend(int n,
+    int workers){
+
+    int start = circles.size();
+    if(n <= start){
+        return circles;
+    }
+
+    // Checked before the circles grow, like generateCirclesFFT does
+    if(policy.getMethod() == IntegrationMethod::FFT
+        && std::abs(h.getDuration() - 1) > 1e-9){
+        throw std::invalid_argument(
+            "The curves must be defined between t = 0 and t = 1");
+    }
+
+    /**************************************************************************
+     * If generating the new circles fails, they are dropped again, so that
+     * the generator still only holds finished circles, and the next call
+     * generates them again.
+    **************************************************************************/
+    circles.resize(n);
+    try{
+        generate(start, n, workers);
+    }
+    catch(...){
+        circles.resize(start);
+        throw;
+    }
+    return circles;
+}
+
+
+// Generate function definition
+void CircleGenerator::generate(int start, int end, int workers){
+    if(policy.getMethod() == IntegrationMethod::FFT){
+        extendFFT(start, end);
+        return;
+    }
+
+    ThreadPool pool(workers);
+    if(policy.getMethod() == IntegrationMethod::RIEMANN_SUM){
+        extendRiemann(start, end, pool);
+        return;
+    }
+
+    // Small batches, since the fast circles cost more than the slow ones
+    int batchSize = std::max(1, (end - start) / (pool.getWorkerCount() * 8));
+    for(int first = start; first < end; first += batchSize){
+        int last = std::min(end, first + batchSize);
+        pool.submit([this, first, last]{
+            for(int i = first; i < last; i++){
+                circles[i] = h.integrate(policy,
+                    FourierSeries::getFrequency(i));
+            }
+        });
+    }
+    pool.wait();
+}
+
+
+// Extend Riemann function definition
+void CircleGenerator::extendRiemann(int start, int end, ThreadPool& pool){
+    /**************************************************************************
+     * The circles at indices 0 to n - 1 need the frequencies -(n / 2) to
+     * (n - 1) / 2, so the new circles need two ranges of frequencies, one
+     * below the negative ones already done, one above the positive ones.
+    **************************************************************************/
+    int ranges[2][2] = {
+        {-(end / 2), -(start / 2) - 1},
+        {start > 0 ? (start - 1) / 2 + 1 : 0, (end - 1) / 2}
+    };
+
+    // Each range is split by curve on the pool, evaluating every sample once
+    for(const auto& range : ranges){
+        std::vector<ComplexNumber> integrals = h.integrateAll(
+            policy.getDt(), range[0], range[1], pool);
+        for(int frequency = range[0]; frequency <= range[1]; frequency++){
+            // n = -k is the circle at odd index 2k - 1, n = k at 2k
+            int index = (frequency < 0) ? -2 * frequency - 1 : 2 * frequency;
+            circles[index] = integrals[frequency - range[0]];
+        }
+    }
+}
+
+
+// Extend FFT function definition
+void CircleGenerator::extendFFT(int start, int end){
+    /**************************************************************************
+     * As in FourierSeries::generateCirclesFFT, there must be more samples
+     * than circles, and a step no larger than dt. The duration of the
+     * curves was checked by extend.
+    **************************************************************************/
+    if(spectrum.size() < end + 1){
+        int size = std::max(static_cast<int>(std::ceil(1 / policy.getDt())),
+            end + 1);
+        spectrum = h.sample(FastFourierTransform::nextPowerOfTwo(size));
+        FastFourierTransform::forward(spectrum);
+    }
+
+    int size = spectrum.size();
+    for(int i = start; i < end; i++){
+        // Odd circles spin at (i + 1) / 2, even ones at -i / 2
+        int k = (i % 2 == 1) ? (i + 1) / 2 : size - i / 2;
+        circles[i] = spectrum[k % size] / size;
+    }
+}
+
+
+// Get circles function definition
+const std::vector<ComplexNumber>& CircleGenerator::getCircles() const{
+    return circles;
+}
+
+
+// Get circle number function definition
+int CircleGenerator::getCircleNumber() const{
+    return circles.size();
+}
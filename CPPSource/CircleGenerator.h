@@ -0,0 +1,92 @@
+/******************************************************************************
+ * CircleGenerator.h
+ * Header file for the CircleGenerator class, which generates the circles
+ * of a Fourier series a few at a time, keeping the ones it already has.
+ * Asking FourierSeries::generateCircles for more circles computes all of
+ * them again, including the ones it had before. The generator instead
+ * appends the circles after the ones it holds, so a coarse drawing can be
+ * shown right away, and refined as the faster circles come in.
+******************************************************************************/
+
+#ifndef CIRCLE_GENERATOR_H
+#define CIRCLE_GENERATOR_H
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "BezierCurveVector.h"
+#include "ComplexNumber.h"
+#include "FastFourierTransform.h"
+#include "FourierSeries.h"
+#include "IntegrationPolicy.h"
+#include "ThreadPool.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * CircleGenerator class definition.
+     * The circles are in the order generateCircles returns them, and have
+     * the same values for the same policy, whatever steps they are
+     * generated in, except with IntegrationMethod::FFT. That method keeps
+     * the transform of the samples, from which new circles are read for
+     * free as long as there are enough samples. When there are too few,
+     * the path is sampled again, more finely, and only the new circles are
+     * read from the new transform.
+    **************************************************************************/
+    class CircleGenerator{
+    private:
+
+        BezierCurveVector h;            // Path the circles draw
+        IntegrationPolicy policy;       // How the circles are integrated
+
+        std::vector<ComplexNumber> circles;     // Circles generated so far
+        std::vector<ComplexNumber> spectrum;    // Transform, for the FFT
+
+        /**********************************************************************
+         * Generates the circles at indices start to end - 1 with a Riemann
+         * sum, the new frequencies being integrated together by
+         * BezierCurveVector::integrateAll, its batches of curves running on
+         * the pool.
+        **********************************************************************/
+        void extendRiemann(int start, int end, ThreadPool& pool);
+
+        // Generates the circles at indices start to end - 1 from a transform
+        void extendFFT(int start, int end);
+
+        /**********************************************************************
+         * Generates the circles at indices start to end - 1, which must
+         * already exist, with the method of the policy, on the given
+         * number of workers.
+        **********************************************************************/
+        void generate(int start, int end, int workers);
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the path and how to integrate it.
+         * No circles are generated until extend is called.
+        **********************************************************************/
+        CircleGenerator(const BezierCurveVector& h,
+            const IntegrationPolicy& policy);
+
+        /**********************************************************************
+         * Generates circles until there are n of them, on the given number
+         * of workers (0 for one per hardware thread), and returns all the
+         * circles. Does nothing if there are already n or more.
+         * Throws an invalid argument error if the method is FFT and the
+         * curves aren't defined between t = 0 and t = 1. If generating
+         * fails, the circles that were there before are kept, and no new
+         * ones are added.
+        **********************************************************************/
+        const std::vector<ComplexNumber>& extend(int n, int workers);
+
+        // Returns the circles generated so far
+        const std::vector<ComplexNumber>& getCircles() const;
+
+        // Returns the number of circles generated so far
+        int getCircleNumber() const;
+    };
+}
+
+#endif
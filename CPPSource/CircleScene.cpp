@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Source file for the CircleScene class member functions.
+******************************************************************************/
+
+#include "CircleScene.h"
+
+#ifndef FS_HEADLESS
+
+using namespace fs;
+
+
+// Argumented constructor definition
+CircleScene::CircleScene(const std::vector<ComplexNumber>& circles,
+    bool showCircles, real minimumRadius) : unitX(SEGMENTS),
+    unitY(SEGMENTS), circleNumber(circles.size()),
+    showCircles{showCircles} {
+
+    for(int i = 0; i < circles.size(); i++){
+        real radius = circles[i].getMagnitude();
+        if(radius >= minimumRadius){
+            visible.push_back(i);
+            radii.push_back(radius);
+        }
+    }
+
+    for(int s = 0; s < SEGMENTS; s++){
+        unitX[s] = cos(2 * PI * s / SEGMENTS);
+        unitY[s] = sin(2 * PI * s / SEGMENTS);
+    }
+
+    // The outlines are faint, like the ones the window drew before
+    if(showCircles){
+        outlines.assign(2 * SEGMENTS * visible.size(),
+            sf::Vertex(sf::Vector2f(0, 0), sf::Color(255, 255, 255, 40)));
+    }
+    // The origin, the end of each visible vector, and the tip
+    vectors.assign(visible.size() + 2,
+        sf::Vertex(sf::Vector2f(0, 0), sf::Color::Blue));
+}
+
+
+// Update function definition
+void CircleScene::update(const AnimationEngine& engine){
+    real x{0}, y{0};
+    int next = 0;       // Next circle to add to the tip
+    for(int v = 0; v < visible.size(); v++){
+        // The hidden circles before this one only move its center
+        for(; next < visible[v]; next++){
+            ComplexNumber circle = engine.getCircle(next);
+            x += circle.getReal();
+            y += circle.getImaginary();
+        }
+
+        if(showCircles){
+            // The circle turned by the vector is centered at its base
+            sf::Vertex* side = &outlines[2 * SEGMENTS * v];
+            real radius = radii[v];
+            for(int s = 0; s < SEGMENTS; s++){
+                int corner = (s + 1 == SEGMENTS) ? 0 : s + 1;
+                side[2 * s].position = sf::Vector2f(x + radius * unitX[s],
+                    y + radius * unitY[s]);
+                side[2 * s + 1].position = sf::Vector2f(
+                    x + radius * unitX[corner], y + radius * unitY[corner]);
+            }
+        }
+
+        ComplexNumber circle = engine.getCircle(next++);
+        x += circle.getReal();
+        y += circle.getImaginary();
+        vectors[v + 1].position = sf::Vector2f(x, y);
+    }
+
+    for(; next < circleNumber; next++){
+        ComplexNumber circle = engine.getCircle(next);
+        x += circle.getReal();
+        y += circle.getImaginary();
+    }
+    vectors.back().position = sf::Vector2f(x, y);
+    tip = ComplexNumber(x, y);
+}
+
+
+// Get tip function definition
+ComplexNumber CircleScene::getTip() const{
+    return tip;
+}
+
+
+// Get visible circle number function definition
+int CircleScene::getVisibleCircleNumber() const{
+    return visible.size();
+}
+
+
+// Draw function definition
+void CircleScene::draw(sf::RenderTarget& target,
+    sf::RenderStates states) const{
+
+    if(!outlines.empty()){
+        target.draw(outlines.data(), outlines.size(), sf::Lines, states);
+    }
+    target.draw(vectors.data(), vectors.size(), sf::LineStrip, states);
+}
+
+#endif
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * CircleScene.h
+ * Header file for the CircleScene class, which holds the geometry the SFML
+ * window draws for the circles and vectors of the animation.
+ * Building an sf::CircleShape per circle every frame allocates and sets up
+ * each shape from scratch, and draws each one with a call of its own. The
+ * scene instead allocates the vertices of every circle once, and each
+ * frame only moves them to their new positions, so that all the circles
+ * are drawn as a single list of lines, and the vectors as a single strip.
+ * It only exists in the SFML build.
+******************************************************************************/
+
+#ifndef CIRCLE_SCENE_H
+#define CIRCLE_SCENE_H
+
+#ifndef FS_HEADLESS
+
+#include <cmath>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "AnimationEngine.h"
+#include "ComplexNumber.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * CircleScene class definition.
+     * Each circle is a polygon of SEGMENTS sides, stored as a pair of
+     * vertices per side, so that the circles don't join each other the way
+     * they would in a single strip. The colors of the vertices never change
+     * and are only set when the scene is created.
+     * Most of the fast circles are far smaller than a pixel, so circles
+     * with a radius below a threshold get no geometry at all. Their vectors
+     * are merged into the vector of the next visible circle, and still
+     * move the tip, so the vertices drawn only grow with the circles that
+     * can actually be seen.
+    **************************************************************************/
+    class CircleScene : public sf::Drawable{
+    private:
+
+        // Sides of the polygon drawn for a circle, as in sf::CircleShape
+        static constexpr int SEGMENTS = 30;
+
+        std::vector<int> visible;           // Circles large enough to see
+        std::vector<real> radii;            // Radius of each visible circle
+        std::vector<real> unitX, unitY;     // Corners of the unit polygon
+
+        std::vector<sf::Vertex> outlines;   // Sides of the circles
+        std::vector<sf::Vertex> vectors;    // Chain from the origin to tip
+        ComplexNumber tip;                  // Tip, in full precision
+        int circleNumber;                   // Circles, visible or not
+
+        bool showCircles;   // Whether the circles are drawn with the vectors
+
+        // Draws the circles and the vectors, called by window.draw(scene)
+        void draw(sf::RenderTarget& target,
+            sf::RenderStates states) const override;
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the circles at the start of the
+         * animation, whether to draw the circles or only the vectors, and
+         * the radius in pixels below which a circle isn't drawn, 0 drawing
+         * all of them.
+        **********************************************************************/
+        CircleScene(const std::vector<ComplexNumber>& circles,
+            bool showCircles, real minimumRadius);
+
+        /**********************************************************************
+         * Moves the vectors, and the circles they turn in, to the current
+         * frame of the engine, which must have as many circles as the scene.
+        **********************************************************************/
+        void update(const AnimationEngine& engine);
+
+        // Returns the tip of the last vector, as of the last update
+        ComplexNumber getTip() const;
+
+        // Returns the number of circles drawn
+        int getVisibleCircleNumber() const;
+    };
+}
+
+#endif
+
+#endif
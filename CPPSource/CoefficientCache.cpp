@@ -0,0 +1,175 @@
+/******************************************************************************
+ * Source file for the CoefficientCache class member functions.
+******************************************************************************/
+
+#include "CoefficientCache.h"
+
+using namespace fs;
+
+namespace {
+    // The doubles are stored as their 64 bits
+    static_assert(std::numeric_limits<double>::is_iec559
+        && sizeof(double) == sizeof(uint64_t),
+        "The cache format needs IEEE 754 doubles");
+
+    // Parameters of the 64 bit FNV-1a hash
+    constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    // Adds bytes to an FNV-1a hash
+    uint64_t addBytes(uint64_t hash, const char* bytes, size_t size){
+        for(size_t i = 0; i < size; i++){
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    // Adds a number to an FNV-1a hash, byte by byte from the lowest
+    uint64_t addNumber(uint64_t hash, uint64_t value){
+        for(int i = 0; i < 8; i++){
+            hash ^= (value >> (8 * i)) & 0xFF;
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    uint64_t toBits(double value){
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    double fromBits(uint64_t bits){
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+
+// Argumented constructor definition
+CoefficientCache::CoefficientCache(const std::string& directory)
+    : directory{directory} {}
+
+
+// Get file path function definition
+std::string CoefficientCache::getFilePath(uint64_t key) const{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin",
+        static_cast<unsigned long long>(key));
+    return (std::filesystem::path(directory) / name).string();
+}
+
+
+// Read little endian function definition
+uint64_t CoefficientCache::readLittleEndian(const char* bytes, int size){
+    uint64_t value{0};
+    for(int i = 0; i < size; i++){
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[i]))
+            << (8 * i);
+    }
+    return value;
+}
+
+
+// Write little endian function definition
+void CoefficientCache::writeLittleEndian(char* bytes, uint64_t value,
+    int size){
+
+    for(int i = 0; i < size; i++){
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+
+// Hash function definition
+uint64_t CoefficientCache::hash(std::string_view svg, int n,
+    const IntegrationPolicy& policy, int canvasSize){
+
+    uint64_t hash = addNumber(FNV_OFFSET, GENERATOR_VERSION);
+    hash = addBytes(hash, svg.data(), svg.size());
+    hash = addNumber(hash, n);
+    hash = addNumber(hash, static_cast<uint64_t>(policy.getMethod()));
+    hash = addNumber(hash, toBits(policy.getDt()));
+    hash = addNumber(hash, policy.getOrder());
+    hash = addNumber(hash, toBits(policy.getTolerance()));
+    hash = addNumber(hash, canvasSize);
+    return hash;
+}
+
+
+// Load function definition
+bool CoefficientCache::load(uint64_t key,
+    std::vector<ComplexNumber>& circles) const{
+
+    /**************************************************************************
+     * A directory that can't be read, like a missing file, is only a miss,
+     * so the error is kept in a code rather than thrown.
+    **************************************************************************/
+    std::string filePath = getFilePath(key);
+    std::error_code error;
+    if(!std::filesystem::exists(filePath, error)){
+        return false;
+    }
+
+    try{
+        MappedFile file(filePath);
+        std::string_view data = file.getView();
+        if(data.size() < HEADER_SIZE || data.substr(0, 4) != "FSCC"
+            || readLittleEndian(data.data() + 4, 4) != VERSION
+            || readLittleEndian(data.data() + 8, 8) != key){
+            return false;
+        }
+
+        size_t count = readLittleEndian(data.data() + 16, 4);
+        if(data.size() != HEADER_SIZE + 16 * count){
+            return false;
+        }
+
+        const char* values = data.data() + HEADER_SIZE;
+        circles.resize(count);
+        for(size_t i = 0; i < count; i++){
+            circles[i] = ComplexNumber(
+                fromBits(readLittleEndian(values + 16 * i, 8)),
+                fromBits(readLittleEndian(values + 16 * i + 8, 8)));
+        }
+        return true;
+    }
+    catch(const std::runtime_error&){
+        // A file that can't be mapped is treated as missing
+        return false;
+    }
+}
+
+
+// Store function definition
+void CoefficientCache::store(uint64_t key,
+    const std::vector<ComplexNumber>& circles) const{
+
+    std::vector<char> data(HEADER_SIZE + 16 * circles.size());
+    std::memcpy(data.data(), "FSCC", 4);
+    writeLittleEndian(data.data() + 4, VERSION, 4);
+    writeLittleEndian(data.data() + 8, key, 8);
+    writeLittleEndian(data.data() + 16, circles.size(), 4);
+    writeLittleEndian(data.data() + 20, 0, 4);
+
+    char* values = data.data() + HEADER_SIZE;
+    for(size_t i = 0; i < circles.size(); i++){
+        writeLittleEndian(values + 16 * i, toBits(circles[i].getReal()), 8);
+        writeLittleEndian(values + 16 * i + 8,
+            toBits(circles[i].getImaginary()), 8);
+    }
+
+    std::filesystem::create_directories(directory);
+    std::string filePath = getFilePath(key);
+    std::string temporaryPath = filePath + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary);
+        file.write(data.data(), data.size());
+        if(!file){
+            throw std::runtime_error("Could not write " + temporaryPath);
+        }
+    }
+    std::filesystem::rename(temporaryPath, filePath);
+}
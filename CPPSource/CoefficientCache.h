@@ -0,0 +1,101 @@
+/******************************************************************************
+ * CoefficientCache.h
+ * Header file for the CoefficientCache class, which keeps the circles
+ * generated for an svg file on disk, so that running again with the same
+ * file and parameters skips both parsing and integrating.
+ * Each set of circles is stored in a file of its own, named after a 64 bit
+ * FNV-1a hash of the svg file and of every parameter the circles depend
+ * on. The files are in a compact little-endian binary format, and are
+ * memory mapped when loaded.
+******************************************************************************/
+
+#ifndef COEFFICIENT_CACHE_H
+#define COEFFICIENT_CACHE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+#include "ComplexNumber.h"
+#include "IntegrationPolicy.h"
+#include "MappedFile.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * CoefficientCache class definition.
+     * A cache file holds, in order:
+     *  - the 4 bytes "FSCC", and the version of the format (32 bits),
+     *  - the key the circles were stored under (64 bits),
+     *  - the number of circles (32 bits), and 4 bytes of padding,
+     *  - the real and imaginary parts of each circle, as IEEE 754 doubles.
+     * Integers and doubles are little-endian whatever the machine, so the
+     * files can be shared. A file that doesn't match its name, or that is
+     * cut short, is ignored, and regenerated.
+    **************************************************************************/
+    class CoefficientCache{
+    private:
+
+        std::string directory;      // Directory the cache files are in
+
+        // Version written in the files, changed with the format
+        static constexpr uint32_t VERSION = 1;
+
+        /**********************************************************************
+         * Version of the code that turns a file into circles, part of every
+         * key. It must be changed along with anything that changes the
+         * circles of the same file and parameters, such as the parsing,
+         * stitching, scaling or integration, or the stale circles of the
+         * older code would still be loaded.
+        **********************************************************************/
+        static constexpr uint32_t GENERATOR_VERSION = 2;
+
+        // Size of the header before the circles
+        static constexpr size_t HEADER_SIZE = 24;
+
+        // Returns the path of the file holding the circles of a key
+        std::string getFilePath(uint64_t key) const;
+
+        // Read and write little-endian integers from and to bytes
+        static uint64_t readLittleEndian(const char* bytes, int size);
+        static void writeLittleEndian(char* bytes, uint64_t value, int size);
+
+    public:
+
+        // Argumented constructor, takes the directory of the cache files
+        CoefficientCache(const std::string& directory);
+
+        /**********************************************************************
+         * Returns the key of the circles generated from the given svg file
+         * contents, for n circles integrated with the given policy, and
+         * scaled to a canvas of the given size, by this version of the
+         * generator.
+        **********************************************************************/
+        static uint64_t hash(std::string_view svg, int n,
+            const IntegrationPolicy& policy, int canvasSize);
+
+        /**********************************************************************
+         * Loads the circles stored under a key into circles, and returns
+         * true, or returns false, leaving circles as is, if there are none
+         * or the file is not a valid cache file.
+        **********************************************************************/
+        bool load(uint64_t key, std::vector<ComplexNumber>& circles) const;
+
+        /**********************************************************************
+         * Stores the circles under a key, creating the directory if needed.
+         * The file is written under another name and then renamed, so that
+         * a run stopped halfway never leaves a partial file behind.
+         * Throws a runtime error if the file can't be written.
+        **********************************************************************/
+        void store(uint64_t key, const std::vector<ComplexNumber>& circles)
+            const;
+    };
+}
+
+#endif
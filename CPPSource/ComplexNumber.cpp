@@ -84,6 +84,18 @@ ComplexNumber& ComplexNumber::operator+=(const ComplexNumber& right){
     return *this;
 }
 
+// Overloaded - operator function definition
+ComplexNumber ComplexNumber::operator-(const ComplexNumber& right) const{
+    ComplexNumber temp{r - right.r, i - right.i};
+    return temp;
+}
+
+// Overloaded -= operator funciton definition
+ComplexNumber& ComplexNumber::operator-=(const ComplexNumber& right){
+    *this = *this - right;
+    return *this;
+}
+
 // Overloaded * operator function definition
 ComplexNumber ComplexNumber::operator*(const ComplexNumber& right) const{
     ComplexNumber temp{r * right.r - i * right.i, 
@@ -94,6 +94,20 @@ namespace fs {
         **********************************************************************/
         ComplexNumber& operator+=(const ComplexNumber&);
 
+        /**********************************************************************
+         * Overloaded - operator
+         * Caluclates and returns the difference of two complex numbers;
+         * the real and imaginary parts are individually subtracted.
+        **********************************************************************/
+        ComplexNumber operator-(const ComplexNumber&) const;
+
+        /**********************************************************************
+         * Overloaded -= operator
+         * Applies the same operation as the - operator, but also updates
+         * the value of the calling object which is returned.
+        **********************************************************************/
+        ComplexNumber& operator-=(const ComplexNumber&);
+
         /**********************************************************************
          * Overloaded * operator
          * Caluclates and returns the product of two complex numbers;
@@ -0,0 +1,276 @@
+/******************************************************************************
+ * Source file for the CurveIntegrator class member functions.
+******************************************************************************/
+
+#include "CurveIntegrator.h"
+
+using namespace fs;
+
+
+// Get sample count function definition
+int CurveIntegrator::getSampleCount(real t0, real t1, real dt){
+    if(t1 < t0){
+        return 0;
+    }
+
+    /**************************************************************************
+     * The division can round either way when t1 - t0 is a multiple of dt,
+     * so the count is corrected until its last sample is the last one
+     * that is <= t1.
+    **************************************************************************/
+    int samples = static_cast<int>(std::floor((t1 - t0) / dt)) + 1;
+    while(samples > 0 && t0 + (samples - 1) * dt > t1){
+        samples--;
+    }
+    while(t0 + samples * dt <= t1){
+        samples++;
+    }
+    return samples;
+}
+
+
+// Integrate Riemann function definition
+ComplexNumber CurveIntegrator::integrateRiemann(const PolynomialView& x,
+    const PolynomialView& y, real t0, real t1, real dt, int n){
+
+    // Divides area under curve into rectangles of width dt
+    return SimdKernels::integrate(x, y, t0, dt, getSampleCount(t0, t1, dt),
+        n);
+}
+
+
+// Integrate exact function definition
+template<class P>
+ComplexNumber CurveIntegrator::integrateExact(const P& x, const P& y,
+    real t0, real t1, int n){
+    // Without the exponential term, only the polynomials are integrated
+    if(n == 0){
+        ComplexNumber result(x.getAntiderivativeValue(t1) 
+            - x.getAntiderivativeValue(t0),
+            y.getAntiderivativeValue(t1) 
+            - y.getAntiderivativeValue(t0));
+        return result;
+    }
+
+    real w = 2 * PI * n;
+
+    /**************************************************************************
+     * The kth term of the antiderivative is (-1)^k * p^(k)(t) / a^(k+1),
+     * where a = i * w. The factor starts at 1 / a = -i / w, and each term
+     * multiplies it by -1 / a = i / w.
+    **************************************************************************/
+    ComplexNumber factor(0, -1 / w);
+    ComplexNumber step(0, 1 / w);
+    ComplexNumber start{}, end{};
+
+    int degree = std::max(x.getDegree(), y.getDegree());
+    for(int k = 0; k <= degree; k++){
+        start += ComplexNumber(x.getDerivativeValue(t0, k),
+            y.getDerivativeValue(t0, k)) * factor;
+        end += ComplexNumber(x.getDerivativeValue(t1, k),
+            y.getDerivativeValue(t1, k)) * factor;
+        factor *= step;
+    }
+
+    // The polynomial sums are then multiplied by e^(a * t) at both bounds
+    ComplexNumber exponentStart(cos(w * t0), sin(w * t0));
+    ComplexNumber exponentEnd(cos(w * t1), sin(w * t1));
+    return end * exponentEnd - start * exponentStart;
+}
+
+
+// Integrate Gauss-Legendre function definition
+template<class P>
+ComplexNumber CurveIntegrator::integrateGaussLegendre(const P& x, const P& y,
+    real t0, real t1, real dt, int order, int n){
+
+    const std::vector<real>& nodes = GaussLegendre::getNodes(order);
+    const std::vector<real>& weights = GaussLegendre::getWeights(order);
+
+    /**************************************************************************
+     * Without a width, the sub-intervals are as wide as the exponential
+     * allows: a rule of order m resolves about m / 16 of its turns to
+     * near rounding error, and it turns |n| times in a time of 1.
+    **************************************************************************/
+    real pieces = (dt > 0) ? (t1 - t0) / dt
+        : std::abs(n) * (t1 - t0) * 16 / order;
+    int intervals = std::max(1, static_cast<int>(std::ceil(pieces)));
+    real width = (t1 - t0) / intervals;
+    real w = 2 * PI * n;
+
+    real r{0}, i{0};
+    for(int interval = 0; interval < intervals; interval++){
+        /**********************************************************************
+         * The nodes are given on [-1, 1], and are mapped to the middle of
+         * the sub-interval plus or minus half its width.
+        **********************************************************************/
+        real middle = t0 + (interval + 0.5) * width;
+        for(int k = 0; k < order; k++){
+            real t = middle + nodes[k] * width / 2;
+            real xValue = x.getValue(t);
+            real yValue = y.getValue(t);
+            real cosine = cos(w * t);
+            real sine = sin(w * t);
+
+            r += weights[k] * (xValue * cosine - yValue * sine);
+            i += weights[k] * (xValue * sine + yValue * cosine);
+        }
+    }
+
+    // The weights sum to 2, the length of [-1, 1]
+    ComplexNumber result(r * width / 2, i * width / 2);
+    return result;
+}
+
+
+// The polynomial types the templates above are used with
+template ComplexNumber CurveIntegrator::integrateExact(
+    const PolynomialView&, const PolynomialView&, real, real, int);
+template ComplexNumber CurveIntegrator::integrateExact(
+    const FixedPolynomial<1>&, const FixedPolynomial<1>&, real, real, int);
+template ComplexNumber CurveIntegrator::integrateExact(
+    const FixedPolynomial<2>&, const FixedPolynomial<2>&, real, real, int);
+template ComplexNumber CurveIntegrator::integrateExact(
+    const FixedPolynomial<3>&, const FixedPolynomial<3>&, real, real, int);
+
+template ComplexNumber CurveIntegrator::integrateGaussLegendre(
+    const PolynomialView&, const PolynomialView&, real, real, real, int, int);
+template ComplexNumber CurveIntegrator::integrateGaussLegendre(
+    const FixedPolynomial<1>&, const FixedPolynomial<1>&, real, real, real,
+    int, int);
+template ComplexNumber CurveIntegrator::integrateGaussLegendre(
+    const FixedPolynomial<2>&, const FixedPolynomial<2>&, real, real, real,
+    int, int);
+template ComplexNumber CurveIntegrator::integrateGaussLegendre(
+    const FixedPolynomial<3>&, const FixedPolynomial<3>&, real, real, real,
+    int, int);
+
+
+// Integrate Kronrod function definition
+ComplexNumber CurveIntegrator::integrateKronrod(const PolynomialView& x,
+    const PolynomialView& y, real a, real b, real w, real& error,
+    real& rounding){
+
+    real middle = (a + b) / 2;
+    real halfWidth = (b - a) / 2;
+
+    real kronrodR{0}, kronrodI{0}, gaussR{0}, gaussI{0}, absolute{0};
+    for(int k = 0; k < GaussKronrod::NODE_COUNT; k++){
+        // Every node but the last (0) stands for a symmetric pair
+        int sides = (k == GaussKronrod::NODE_COUNT - 1) ? 1 : 2;
+        for(int side = 0; side < sides; side++){
+            real offset = (side == 0 ? 1 : -1) * GaussKronrod::NODES[k];
+            real t = middle + offset * halfWidth;
+            real xValue = x.getValue(t);
+            real yValue = y.getValue(t);
+            real cosine = cos(w * t);
+            real sine = sin(w * t);
+            real r = xValue * cosine - yValue * sine;
+            real i = xValue * sine + yValue * cosine;
+
+            kronrodR += GaussKronrod::KRONROD_WEIGHTS[k] * r;
+            kronrodI += GaussKronrod::KRONROD_WEIGHTS[k] * i;
+            absolute += GaussKronrod::KRONROD_WEIGHTS[k] 
+                * (x.getAbsoluteValue(t) 
+                + y.getAbsoluteValue(t));
+            if(k % 2 == 1){
+                gaussR += GaussKronrod::GAUSS_WEIGHTS[k / 2] * r;
+                gaussI += GaussKronrod::GAUSS_WEIGHTS[k / 2] * i;
+            }
+        }
+    }
+
+    ComplexNumber kronrod(kronrodR * halfWidth, kronrodI * halfWidth);
+    ComplexNumber gauss(gaussR * halfWidth, gaussI * halfWidth);
+    error = (kronrod - gauss).getMagnitude();
+    rounding = absolute * halfWidth;
+    return kronrod;
+}
+
+
+// Integrate adaptive function definition
+ComplexNumber CurveIntegrator::integrateAdaptive(const PolynomialView& x,
+    const PolynomialView& y, real t0, real t1, real tolerance, int n,
+    real& error){
+
+    real w = 2 * PI * n;
+    real length = t1 - t0;
+
+    /**************************************************************************
+     * A single rule can't follow many turns of the exponential, so the
+     * curve starts out split into pieces of about 2 turns each, n turns
+     * fitting in a time of 1. Low frequencies start from a single piece.
+    **************************************************************************/
+    int pieces = std::max(1, static_cast<int>(std::ceil(std::abs(n) 
+        * length / 2)));
+
+    // Pieces narrower than this are accepted whatever their estimate
+    real minimumWidth = length * 1e-6;
+
+    /**************************************************************************
+     * Nor can the estimate go much below the rounding error of evaluating
+     * the polynomials, so a piece whose estimate is that small is accepted
+     * too, even if the tolerance asked for more.
+    **************************************************************************/
+    real roundoff = 50 * std::numeric_limits<real>::epsilon();
+
+    ComplexNumber result{};
+    error = 0;
+    for(int piece = 0; piece < pieces; piece++){
+        /**********************************************************************
+         * The halves are handled depth first, so the stack never holds
+         * more than one piece per level, and there are only about
+         * log2(1e6) levels above minimumWidth, far fewer than it holds.
+        **********************************************************************/
+        std::pair<real, real> stack[ADAPTIVE_STACK_SIZE];
+        int top = 0;
+        stack[top++] = {t0 + piece * length / pieces,
+            t0 + (piece + 1) * length / pieces};
+
+        while(top > 0){
+            real a = stack[top - 1].first;
+            real b = stack[top - 1].second;
+            top--;
+
+            real pieceError, pieceRounding;
+            ComplexNumber part = integrateKronrod(x, y, a, b, w, pieceError,
+                pieceRounding);
+            if(pieceError <= tolerance * (b - a) / length 
+                || pieceError <= roundoff * pieceRounding
+                || b - a < minimumWidth || top + 2 > ADAPTIVE_STACK_SIZE){
+                result += part;
+                error += pieceError;
+            }
+            else{
+                // The left half is pushed last, so it is handled first
+                stack[top++] = {(a + b) / 2, b};
+                stack[top++] = {a, (a + b) / 2};
+            }
+        }
+    }
+    return result;
+}
+
+
+// Integrate with policy function definition
+ComplexNumber CurveIntegrator::integrate(const PolynomialView& x,
+    const PolynomialView& y, real t0, real t1,
+    const IntegrationPolicy& policy, int n){
+
+    switch(policy.getMethod()){
+        case IntegrationMethod::EXACT:
+            return integrateExact(x, y, t0, t1, n);
+        case IntegrationMethod::GAUSS_LEGENDRE:
+            return integrateGaussLegendre(x, y, t0, t1, policy.getDt(),
+                policy.getOrder(), n);
+        case IntegrationMethod::ADAPTIVE:{
+            real error;
+            return integrateAdaptive(x, y, t0, t1, policy.getTolerance(), n,
+                error);
+        }
+        case IntegrationMethod::RIEMANN_SUM:
+        case IntegrationMethod::FFT:
+        default:
+            return integrateRiemann(x, y, t0, t1, policy.getDt(), n);
+    }
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * CurveIntegrator.h
+ * Header file for the CurveIntegrator class, which holds the integration
+ * kernels of a single Bezier curve.
+ * The kernels only need the x and y polynomials and the time range of the
+ * curve, so they take them as views. That way, the same code integrates a
+ * BezierCurve object and the curves that BezierCurveVector keeps packed
+ * in flat arrays.
+******************************************************************************/
+
+#ifndef CURVE_INTEGRATOR_H
+#define CURVE_INTEGRATOR_H
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include "Polynomial.h"
+#include "FixedPolynomial.h"
+#include "ComplexNumber.h"
+#include "IntegrationPolicy.h"
+#include "GaussLegendre.h"
+#include "GaussKronrod.h"
+#include "SimdKernels.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * CurveIntegrator class definition.
+     * Like SimdKernels, this is a helper class with no member variables.
+     * Every kernel integrates (x(t) + i * y(t)) * e^(2 * pi * i * n * t)
+     * from t = t0 to t = t1; see BezierCurve for what each method does.
+    **************************************************************************/
+    class CurveIntegrator{
+    private:
+
+        // Pieces the adaptive integration holds at once, at most
+        static constexpr int ADAPTIVE_STACK_SIZE = 64;
+
+        /**********************************************************************
+         * Applies the 15 point Gauss-Kronrod rule from t = a to t = b, with
+         * w = 2 * pi * n.
+         * Sets error to the distance between the 15 point result and the
+         * 7 point Gauss result, and rounding to the 15 point integral of
+         * the sizes of the terms of x(t) and y(t), which the rounding error
+         * of the result is proportional to.
+        **********************************************************************/
+        static ComplexNumber integrateKronrod(const PolynomialView& x,
+            const PolynomialView& y, real a, real b, real w, real& error,
+            real& rounding);
+
+    public:
+
+        /**********************************************************************
+         * Returns the number of rectangles of width dt in a Riemann sum from
+         * t0 to t1, which are at t = t0 + s * dt for every s such that
+         * t <= t1.
+        **********************************************************************/
+        static int getSampleCount(real t0, real t1, real dt);
+
+        // Sum of the rectangles of width dt starting at t0
+        static ComplexNumber integrateRiemann(const PolynomialView& x,
+            const PolynomialView& y, real t0, real t1, real dt, int n);
+
+        /**********************************************************************
+         * Closed form of the integral, found by integration by parts.
+         * P is PolynomialView, or the FixedPolynomial of a BezierCurveN, as
+         * for BezierCurveVector::accumulate. The versions for degrees 1 to
+         * 3, which the curves of an svg file have, are compiled in the
+         * source file.
+        **********************************************************************/
+        template<class P>
+        static ComplexNumber integrateExact(const P& x, const P& y, real t0,
+            real t1, int n);
+
+        /**********************************************************************
+         * Gauss-Legendre rule of the given order on sub-intervals of dt,
+         * or of a width picked from n if dt is IntegrationPolicy's
+         * AUTOMATIC_DT, for the same polynomial types as integrateExact.
+        **********************************************************************/
+        template<class P>
+        static ComplexNumber integrateGaussLegendre(const P& x, const P& y,
+            real t0, real t1, real dt, int order, int n);
+
+        // Adaptive Gauss-Kronrod integration to within tolerance
+        static ComplexNumber integrateAdaptive(const PolynomialView& x,
+            const PolynomialView& y, real t0, real t1, real tolerance,
+            int n, real& error);
+
+        /**********************************************************************
+         * Integrates using the method and parameters of the policy.
+         * A single coefficient can't be computed with one transform, so
+         * the FFT method is evaluated as the Riemann sum it stands for.
+        **********************************************************************/
+        static ComplexNumber integrate(const PolynomialView& x,
+            const PolynomialView& y, real t0, real t1,
+            const IntegrationPolicy& policy, int n);
+    };
+}
+
+#endif
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Source file for the FastFourierTransform class member functions.
+******************************************************************************/
+
+#include "FastFourierTransform.h"
+
+using namespace fs;
+
+
+// Recursive transform function definition
+void FastFourierTransform::transform(const real* inputR, const real* inputI,
+    int stride, int n, real* outputR, real* outputI,
+    const std::vector<real>& twiddleR, const std::vector<real>& twiddleI,
+    int twiddleStride){
+
+    if(n == 1){
+        outputR[0] = inputR[0];
+        outputI[0] = inputI[0];
+        return;
+    }
+
+    // Finds the smallest prime factor p of n, which is n itself if n is prime
+    int p = 2;
+    while(p * p <= n && n % p != 0){
+        p++;
+    }
+    if(n % p != 0){
+        p = n;
+    }
+    int m = n / p;
+
+    /**************************************************************************
+     * The qth sub-transform takes every pth element starting at q, and is
+     * written to output[q * m] ... output[q * m + m - 1].
+    **************************************************************************/
+    for(int q = 0; q < p; q++){
+        transform(inputR + q * stride, inputI + q * stride, stride * p, m,
+            outputR + q * m, outputI + q * m, twiddleR, twiddleI,
+            twiddleStride * p);
+    }
+
+    int size = twiddleR.size();
+
+    if(p == 2){
+        /**********************************************************************
+         * Radix-2 butterfly: X[k] = E[k] + w^k * O[k] and
+         * X[k + m] = E[k] - w^k * O[k].
+        **********************************************************************/
+        for(int k = 0; k < m; k++){
+            real wR = twiddleR[k * twiddleStride];
+            real wI = twiddleI[k * twiddleStride];
+            real oR = outputR[k + m] * wR - outputI[k + m] * wI;
+            real oI = outputR[k + m] * wI + outputI[k + m] * wR;
+            outputR[k + m] = outputR[k] - oR;
+            outputI[k + m] = outputI[k] - oI;
+            outputR[k] += oR;
+            outputI[k] += oI;
+        }
+        return;
+    }
+
+    /**************************************************************************
+     * General radix-p step: X[k + m * s] is the sum over q of
+     * w^(q * (k + m * s)) * Y_q[k], where w is the nth root of unity.
+     * For a fixed k, the p inputs and p outputs occupy the same positions,
+     * so they are copied out before being overwritten.
+    **************************************************************************/
+    std::vector<real> tempR(p), tempI(p);
+    for(int k = 0; k < m; k++){
+        for(int q = 0; q < p; q++){
+            tempR[q] = outputR[q * m + k];
+            tempI[q] = outputI[q * m + k];
+        }
+        for(int s = 0; s < p; s++){
+            real sumR = 0, sumI = 0;
+            int index = k + m * s;
+            for(int q = 0; q < p; q++){
+                // Exponents are taken modulo n since w^n = 1
+                long long exponent = (static_cast<long long>(q) * index) % n;
+                int j = static_cast<int>(exponent * twiddleStride % size);
+                sumR += tempR[q] * twiddleR[j] - tempI[q] * twiddleI[j];
+                sumI += tempR[q] * twiddleI[j] + tempI[q] * twiddleR[j];
+            }
+            outputR[index] = sumR;
+            outputI[index] = sumI;
+        }
+    }
+}
+
+
+// In place transform function definition
+void FastFourierTransform::transform(std::vector<ComplexNumber>& data,
+    int sign){
+
+    int n = data.size();
+    if(n == 0){
+        return;
+    }
+
+    // Roots of unity of the full transform, shared by every level
+    std::vector<real> twiddleR(n), twiddleI(n);
+    for(int j = 0; j < n; j++){
+        real angle = sign * 2 * PI * j / n;
+        twiddleR[j] = std::cos(angle);
+        twiddleI[j] = std::sin(angle);
+    }
+
+    std::vector<real> inputR(n), inputI(n), outputR(n), outputI(n);
+    for(int j = 0; j < n; j++){
+        inputR[j] = data[j].getReal();
+        inputI[j] = data[j].getImaginary();
+    }
+
+    transform(inputR.data(), inputI.data(), 1, n, outputR.data(),
+        outputI.data(), twiddleR, twiddleI, 1);
+
+    for(int j = 0; j < n; j++){
+        data[j] = ComplexNumber(outputR[j], outputI[j]);
+    }
+}
+
+
+// Forward function definition
+void FastFourierTransform::forward(std::vector<ComplexNumber>& data){
+    transform(data, -1);
+}
+
+
+// Inverse function definition
+void FastFourierTransform::inverse(std::vector<ComplexNumber>& data){
+    transform(data, 1);
+}
+
+
+// Next power of two function definition
+int FastFourierTransform::nextPowerOfTwo(int n){
+    int result = 1;
+    while(result < n){
+        result *= 2;
+    }
+    return result;
+}
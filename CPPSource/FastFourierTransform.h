@@ -0,0 +1,73 @@
+/******************************************************************************
+ * FastFourierTransform.h
+ * Header file for the FastFourierTransform class, which computes the
+ * discrete Fourier transform of a sequence of complex numbers in
+ * O(n log n) time.
+ * The discrete Fourier transform of x[0] ... x[n-1] is the sequence
+ * X[k] = sum of x[j] * e^(-2 * pi * i * j * k / n) for j = 0 to n - 1.
+ * Sampling a periodic function n times over one period and transforming
+ * the samples gives, up to a factor of n, all of its Fourier coefficients
+ * at once, instead of integrating each one separately.
+******************************************************************************/
+
+#ifndef FAST_FOURIER_TRANSFORM_H
+#define FAST_FOURIER_TRANSFORM_H
+
+#include <vector>
+#include <cmath>
+#include "ComplexNumber.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * FastFourierTransform class definition.
+     * Uses a mixed-radix Cooley-Tukey decomposition: a transform of size
+     * n = p * m, with p the smallest prime factor of n, is split into p
+     * transforms of size m which are then combined. Powers of two take the
+     * radix-2 path at every level, other sizes still work but are slower
+     * when they have large prime factors.
+     * Like FourierSeries, this is a helper class with no member variables.
+    **************************************************************************/
+    class FastFourierTransform{
+    private:
+
+        /**********************************************************************
+         * Recursively transforms n elements of the input arrays, read with
+         * the given stride, into n contiguous elements of the output arrays.
+         * The twiddle table holds e^(sign * 2 * pi * i * j / size) for the
+         * full transform size, and twiddleStride maps the roots of unity of
+         * this subproblem onto it.
+        **********************************************************************/
+        static void transform(const real* inputR, const real* inputI,
+            int stride, int n, real* outputR, real* outputI,
+            const std::vector<real>& twiddleR,
+            const std::vector<real>& twiddleI, int twiddleStride);
+
+        /**********************************************************************
+         * Transforms the data in place, with sign -1 for the forward
+         * transform and 1 for the inverse.
+        **********************************************************************/
+        static void transform(std::vector<ComplexNumber>& data, int sign);
+
+    public:
+
+        /**********************************************************************
+         * Replaces the data with its discrete Fourier transform.
+         * Any size is accepted, an empty vector is left as is.
+        **********************************************************************/
+        static void forward(std::vector<ComplexNumber>& data);
+
+        /**********************************************************************
+         * Replaces the data with its inverse discrete Fourier transform,
+         * x[j] = sum of X[k] * e^(2 * pi * i * j * k / n).
+         * The result is not divided by n, so forward followed by inverse
+         * scales the data by its size.
+        **********************************************************************/
+        static void inverse(std::vector<ComplexNumber>& data);
+
+        // Returns the smallest power of two larger than or equal to n
+        static int nextPowerOfTwo(int n);
+    };
+}
+
+#endif
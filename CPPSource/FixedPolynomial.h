@@ -0,0 +1,176 @@
+/******************************************************************************
+ * FixedPolynomial.h
+ * Header file for the FixedPolynomial class template, a polynomial whose
+ * degree is known at compile time.
+ * The curves read from SVG files are only ever of degree 1 to 3, so their
+ * polynomials don't need a vector: the coefficients are held inline in a
+ * std::array, and every loop over them has a length known at compile time,
+ * which the compiler unrolls.
+ * Being a template, the whole class is defined in this header.
+******************************************************************************/
+
+#ifndef FIXED_POLYNOMIAL_H
+#define FIXED_POLYNOMIAL_H
+
+#include <array>
+#include <stdexcept>
+#include "Polynomial.h"
+#include "unit.h"
+
+namespace fs{
+
+    /**************************************************************************
+     * FixedPolynomial class template definition.
+     * N is the degree, so there are N + 1 coefficients, the ith being that
+     * of t^i. Unlike Polynomial, leading zero coefficients are kept, so
+     * the degree is N whatever the values.
+    **************************************************************************/
+    template<int N>
+    class FixedPolynomial{
+    private:
+
+        static_assert(N >= 0, "The degree can't be negative");
+
+        // Coefficients of the polynomial, the ith being that of t^i
+        std::array<real, N + 1> coefficients;
+
+    public:
+
+        // No arg constructor, the zero polynomial
+        constexpr FixedPolynomial() : coefficients{} {}
+
+        // Argumented constructor, copies N + 1 coefficients, lowest first
+        constexpr explicit FixedPolynomial(const real* coefficients)
+            : coefficients{} {
+            for(int i = 0; i <= N; i++){
+                this->coefficients[i] = coefficients[i];
+            }
+        }
+
+        // Argumented constructor, takes the array of coefficients
+        constexpr explicit FixedPolynomial(
+            const std::array<real, N + 1>& coefficients)
+            : coefficients{coefficients} {}
+
+        static constexpr int getDegree(){       // Getter for the degree
+            return N;
+        }
+
+        // Getter for a coefficient, throws if the index does not exist
+        constexpr real getCoefficient(int index) const{
+            if(index < 0 || index > N){
+                throw std::invalid_argument("The index does not exist");
+            }
+            return coefficients[index];
+        }
+
+        // Setter for a coefficient, throws if the index does not exist
+        constexpr void setCoefficient(real coefficient, int index){
+            if(index < 0 || index > N){
+                throw std::invalid_argument("The index does not exist");
+            }
+            coefficients[index] = coefficient;
+        }
+
+        /**********************************************************************
+         * Non-owning view of the coefficients, for the kernels that take
+         * polynomials of any degree. Only valid as long as the polynomial.
+        **********************************************************************/
+        PolynomialView getView() const{
+            return PolynomialView(coefficients.data(), N);
+        }
+
+        // Returns the value of the polynomial at t using Horner's rule
+        constexpr real getValue(real t) const{
+            real result{};
+            for(int i = N; i >= 0; i--){
+                result = coefficients[i] + t * result;
+            }
+            return result;
+        }
+
+        /**********************************************************************
+         * Returns the value of the kth derivative of the polynomial at t,
+         * in the same steps as PolynomialView::getDerivativeValue, so that
+         * both give the same result.
+        **********************************************************************/
+        constexpr real getDerivativeValue(real t, int k) const{
+            real result{};
+            // Horner's rule over the terms that survive k derivatives
+            for(int i = N; i >= k; i--){
+                real factor = 1;
+                for(int j = i - k + 1; j <= i; j++){
+                    factor *= j;
+                }
+                result = factor * coefficients[i] + t * result;
+            }
+            return result;
+        }
+
+        /**********************************************************************
+         * Returns the value at t of the antiderivative of the polynomial
+         * whose constant of integration is 0.
+        **********************************************************************/
+        constexpr real getAntiderivativeValue(real t) const{
+            real result{};
+            for(int i = N; i >= 0; i--){
+                result = coefficients[i] / (i + 1) + t * result;
+            }
+            return result * t;
+        }
+
+        /**********************************************************************
+         * Overloaded + and - operators.
+         * The result has the larger of the two degrees.
+        **********************************************************************/
+        template<int M>
+        constexpr FixedPolynomial<(N > M ? N : M)> operator+(
+            const FixedPolynomial<M>& polynomial) const{
+            FixedPolynomial<(N > M ? N : M)> result;
+            for(int i = 0; i <= (N > M ? N : M); i++){
+                result.setCoefficient((i <= N ? coefficients[i] : 0)
+                    + (i <= M ? polynomial.getCoefficient(i) : 0), i);
+            }
+            return result;
+        }
+
+        template<int M>
+        constexpr FixedPolynomial<(N > M ? N : M)> operator-(
+            const FixedPolynomial<M>& polynomial) const{
+            FixedPolynomial<(N > M ? N : M)> result;
+            for(int i = 0; i <= (N > M ? N : M); i++){
+                result.setCoefficient((i <= N ? coefficients[i] : 0)
+                    - (i <= M ? polynomial.getCoefficient(i) : 0), i);
+            }
+            return result;
+        }
+
+        /**********************************************************************
+         * Overloaded * operator.
+         * The degree of the product is the sum of the two degrees.
+        **********************************************************************/
+        template<int M>
+        constexpr FixedPolynomial<N + M> operator*(
+            const FixedPolynomial<M>& polynomial) const{
+            std::array<real, N + M + 1> result{};
+            for(int i = 0; i <= N; i++){
+                for(int j = 0; j <= M; j++){
+                    result[i + j] += coefficients[i]
+                        * polynomial.getCoefficient(j);
+                }
+            }
+            return FixedPolynomial<N + M>(result);
+        }
+
+        // Overloaded * operator, multiplies every coefficient by a scalar
+        constexpr FixedPolynomial<N> operator*(real scalar) const{
+            FixedPolynomial<N> result{*this};
+            for(int i = 0; i <= N; i++){
+                result.coefficients[i] *= scalar;
+            }
+            return result;
+        }
+    };
+}
+
+#endif
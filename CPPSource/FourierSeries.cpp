@@ -12,96 +12,433 @@ FourierSeries::FourierSeries() {}
 
 std::string FourierSeries::parseSVG(const std::string& filePath) const {
 
-    std::ifstream svgFile(filePath); // Open the SVG file
-
-    if (!svgFile.is_open()) {
-        return "";
+    try{
+        MappedFile svgFile(filePath);
+        std::vector<std::string_view> paths = findPathData(svgFile.getView());
+        if(!paths.empty()){
+            return std::string(paths.front());
+        }
     }
+    catch(const std::runtime_error&){
+        // A file that can't be opened has no path
+    }
+
+    return "";
+}
 
-    std::string svgContent((std::istreambuf_iterator<char>(svgFile)), 
-        std::istreambuf_iterator<char>());
-    svgFile.close(); // Close the SVG file
 
-    size_t start = svgContent.find("d=\"M") + 3; 
-    size_t end = svgContent.find("\"", start); 
+std::vector<std::string_view> FourierSeries::findPathData(
+    std::string_view svg) const {
+
+    std::vector<std::string_view> paths;
+    size_t element = svg.find("<path");
+    while(element != std::string_view::npos){
+        size_t elementEnd = svg.find('>', element);
+        if(elementEnd == std::string_view::npos){
+            break;
+        }
 
-    if (start != std::string::npos && end != std::string::npos) {
-        std::string pathData = svgContent.substr(start, end - start);
-        return pathData;
+        /**********************************************************************
+         * The d attribute is preceded by a space, which tells it apart from
+         * attributes that end with a d, such as id, and its value can be
+         * quoted either way.
+        **********************************************************************/
+        size_t attribute = element;
+        while(true){
+            attribute = svg.find("d=", attribute + 1);
+            if(attribute == std::string_view::npos || attribute > elementEnd){
+                break;
+            }
+            char before = svg[attribute - 1];
+            char quote = svg[attribute + 2];
+            if(std::isspace(static_cast<unsigned char>(before))
+                && (quote == '"' || quote == '\'')){
+                size_t start = attribute + 3;
+                size_t end = svg.find(quote, start);
+                if(end != std::string_view::npos){
+                    paths.push_back(svg.substr(start, end - start));
+                }
+                break;
+            }
+        }
+
+        element = svg.find("<path", elementEnd);
     }
 
-    return "";
+    return paths;
 }
 
 
 std::vector<std::vector<Point>> FourierSeries::parseSVGPath(
-    const std::string& pathData) const {
+    std::string_view pathData) const {
 
-    std::vector<std::vector<Point>> vectorOfPoints;
+    PathPoints curves;
+    parseSVGPath(pathData, curves);
+    return curves.toVectors();
+}
 
-    // Create a string stream from the SVG path data
-    std::istringstream pathStream(pathData);
 
-    char command;
-    double x, y;
-    Point temp;
+void FourierSeries::parseSVGPath(std::string_view pathData,
+    PathPoints& curves) const {
 
-    while (pathStream >> command) {
+    std::vector<PathPoints> subpaths(1);
+    subpaths[0] = std::move(curves);
+    parsePathData(pathData, subpaths, false);
+    curves = std::move(subpaths[0]);
+}
 
-        std::vector<Point> points;
 
-        switch (command) {
-            case 'M':
-                pathStream >> x >> y; 
-                temp = Point(x, y);
+namespace {
+    /**************************************************************************
+     * Reads the arguments of a path command, given as an upper case letter,
+     * into args, the flags of an arc as 0 or 1. Returns the number of
+     * arguments, -1 for an unsupported command, or -2 if some are missing.
+    **************************************************************************/
+    int readArguments(SVGPathTokenizer& tokenizer, char type, real* args){
+        int count;
+        switch(type){
+            case 'Z':
+                return 0;
+            case 'H':
+            case 'V':
+                count = 1;
                 break;
+            case 'M':
             case 'L':
-                /**************************************************************
-                 * First point in Bezier curve is the last point in the last
-                 * curve.
-                **************************************************************/ 
-                points.push_back(temp);
-                pathStream >> x >> y;
-                // Get a new temp
-                temp = Point(x, y);
-                points.push_back(temp);
-                vectorOfPoints.push_back(points);
+            case 'T':
+                count = 2;
                 break;
+            case 'S':
             case 'Q':
-                points.push_back(temp);
-                pathStream >> x >> y;
-                temp = Point(x, y);
-                points.push_back(temp);
-                pathStream >> x >> y;
-                temp = Point(x, y);
-                points.push_back(temp);
-                vectorOfPoints.push_back(points);
+                count = 4;
                 break;
             case 'C':
-                points.push_back(temp);
-                pathStream >> x >> y;
-                temp = Point(x, y);
-                points.push_back(temp);
-                pathStream >> x >> y;
-                temp = Point(x, y);
-                points.push_back(temp);
-                pathStream >> x >> y;
-                temp = Point(x, y);
-                points.push_back(temp);
-                vectorOfPoints.push_back(points);
-                break;
-            case 'z':
-                // End of the path
+                count = 6;
+                break;
+            case 'A':
+                count = 7;
                 break;
             default:
+                return -1;
+        }
+
+        for(int i = 0; i < count; i++){
+            bool flag;
+            if(type == 'A' && (i == 3 || i == 4)){
+                if(!tokenizer.nextFlag(flag)){
+                    return -2;
+                }
+                args[i] = flag;
+            }
+            else if(!tokenizer.nextNumber(args[i])){
+                return -2;
+            }
+        }
+        return count;
+    }
+
+    /**************************************************************************
+     * Converts the elliptical arc of an svg A command from one point to
+     * another into at most 4 cubic Bezier curves, each spanning a quarter
+     * turn or less of the ellipse, and writes their control points and end
+     * points, 3 per curve, into controls. Returns the number of curves.
+     * The center of the ellipse is found as in the svg specification
+     * (appendix F.6.5), radii too small to reach the end point being
+     * scaled up. The radii must not be zero, and an arc ending where it
+     * starts gives no curves.
+    **************************************************************************/
+    int arcToCubics(const Point& from, real rx, real ry, real rotation,
+        bool largeArc, bool sweep, const Point& to, Point* controls){
+
+        if(from.getX() == to.getX() && from.getY() == to.getY()){
+            return 0;
+        }
+        rx = std::abs(rx);
+        ry = std::abs(ry);
+
+        real phi = rotation * PI / 180;
+        real cosPhi = cos(phi);
+        real sinPhi = sin(phi);
+
+        // The start point, in the frame of the unrotated ellipse
+        real dx = (from.getX() - to.getX()) / 2;
+        real dy = (from.getY() - to.getY()) / 2;
+        real x1 = cosPhi * dx + sinPhi * dy;
+        real y1 = -sinPhi * dx + cosPhi * dy;
+
+        real lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+        if(lambda > 1){
+            rx *= std::sqrt(lambda);
+            ry *= std::sqrt(lambda);
+        }
+
+        real numerator = rx * rx * ry * ry - rx * rx * y1 * y1
+            - ry * ry * x1 * x1;
+        real denominator = rx * rx * y1 * y1 + ry * ry * x1 * x1;
+        real coefficient = std::sqrt(std::max<real>(0,
+            numerator / denominator));
+        if(largeArc == sweep){
+            coefficient = -coefficient;
+        }
+        real centerX1 = coefficient * rx * y1 / ry;
+        real centerY1 = -coefficient * ry * x1 / rx;
+        real centerX = cosPhi * centerX1 - sinPhi * centerY1
+            + (from.getX() + to.getX()) / 2;
+        real centerY = sinPhi * centerX1 + cosPhi * centerY1
+            + (from.getY() + to.getY()) / 2;
+
+        // Angles of the start and end on the unit circle
+        real ux = (x1 - centerX1) / rx;
+        real uy = (y1 - centerY1) / ry;
+        real vx = (-x1 - centerX1) / rx;
+        real vy = (-y1 - centerY1) / ry;
+        real theta = std::atan2(uy, ux);
+        real delta = std::atan2(ux * vy - uy * vx, ux * vx + uy * vy);
+        if(!sweep && delta > 0){
+            delta -= 2 * PI;
+        }
+        else if(sweep && delta < 0){
+            delta += 2 * PI;
+        }
+
+        /**********************************************************************
+         * Each piece of at most a quarter turn is a cubic whose control
+         * points lie on the tangents at its ends, 4 / 3 * tan(angle / 4)
+         * away, which is how close a cubic can get to a circular arc.
+        **********************************************************************/
+        int segments = std::max(1,
+            static_cast<int>(std::ceil(std::abs(delta) / (PI / 2) - 1e-9)));
+        real step = delta / segments;
+        real k = 4.0 / 3.0 * std::tan(step / 4);
+
+        // Maps a point of the unit circle onto the ellipse
+        auto map = [&](real u, real v){
+            return Point(centerX + rx * u * cosPhi - ry * v * sinPhi,
+                centerY + rx * u * sinPhi + ry * v * cosPhi);
+        };
+
+        for(int i = 0; i < segments; i++){
+            real a = theta + i * step;
+            real b = a + step;
+            controls[3 * i] = map(cos(a) - k * sin(a), sin(a) + k * cos(a));
+            controls[3 * i + 1] = map(cos(b) + k * sin(b),
+                sin(b) - k * cos(b));
+            controls[3 * i + 2] = map(cos(b), sin(b));
+        }
+        // The last point is the end point exactly, so the next curve joins
+        controls[3 * segments - 1] = to;
+        return segments;
+    }
+}
+
+
+void FourierSeries::parsePathData(std::string_view pathData,
+    std::vector<PathPoints>& subpaths, bool split) const {
+
+    SVGPathTokenizer tokenizer(pathData);
+    Point temp;         // Current point, where the next curve starts
+    Point start;        // First point of the current subpath
+    Point control;      // Last control point, reflected by S and T
+    char command = 0;   // Command being read, repeated if numbers follow
+    char previous = 0;  // Type of the last command read
+
+    if(subpaths.empty()){
+        subpaths.emplace_back();
+    }
+
+    /**************************************************************************
+     * First point in Bezier curve is the last point in the last curve,
+     * and the last point becomes the current point.
+    **************************************************************************/
+    auto addCurve = [&](std::initializer_list<Point> points){
+        PathPoints& curves = subpaths.back();
+        curves.addPoint(temp);
+        for(const Point& point : points){
+            curves.addPoint(point);
+        }
+        curves.endCurve();
+        temp = *(points.end() - 1);
+    };
+
+    // The reflection of the last control point about the current point
+    auto reflect = [&](char type1, char type2){
+        if(previous != type1 && previous != type2){
+            return temp;
+        }
+        return Point(2 * temp.getX() - control.getX(),
+            2 * temp.getY() - control.getY());
+    };
+
+    while(!tokenizer.isAtEnd()){
+        /**********************************************************************
+         * A command given several sets of arguments is repeated for each,
+         * so numbers with no letter before them belong to the last command.
+         * Numbers after z, or with no command at all, are skipped.
+        **********************************************************************/
+        char next;
+        if(tokenizer.nextCommand(next)){
+            command = next;
+        }
+        else if(command == 0 || command == 'z' || command == 'Z'){
+            tokenizer.skipToken();
+            continue;
+        }
+
+        bool relative = std::islower(static_cast<unsigned char>(command));
+        char type = std::toupper(static_cast<unsigned char>(command));
+        real args[7];
+        int count = readArguments(tokenizer, type, args);
+        if(count == -1){
+            // Unsupported commands are skipped, with their numbers
+            command = 0;
+            continue;
+        }
+        else if(count == -2){
+            // A command missing numbers ends the path, without being added
+            return;
+        }
+
+        // Lower case commands give points relative to the current point
+        real dx = relative ? temp.getX() : 0;
+        real dy = relative ? temp.getY() : 0;
+
+        switch(type){
+            case 'M':
+                temp = Point(args[0] + dx, args[1] + dy);
+                start = temp;
+                if(split && subpaths.back().getCurveNumber() > 0){
+                    subpaths.emplace_back();
+                }
+                // The points after the first one are lines
+                command = relative ? 'l' : 'L';
+                break;
+            case 'L':
+                addCurve({Point(args[0] + dx, args[1] + dy)});
+                break;
+            case 'H':
+                addCurve({Point(args[0] + dx, temp.getY())});
+                break;
+            case 'V':
+                addCurve({Point(temp.getX(), args[0] + dy)});
+                break;
+            case 'C':
+                control = Point(args[2] + dx, args[3] + dy);
+                addCurve({Point(args[0] + dx, args[1] + dy), control,
+                    Point(args[4] + dx, args[5] + dy)});
+                break;
+            case 'S':{
+                Point first = reflect('C', 'S');
+                control = Point(args[0] + dx, args[1] + dy);
+                addCurve({first, control, Point(args[2] + dx, args[3] + dy)});
+                break;
+            }
+            case 'Q':
+                control = Point(args[0] + dx, args[1] + dy);
+                addCurve({control, Point(args[2] + dx, args[3] + dy)});
+                break;
+            case 'T':
+                control = reflect('Q', 'T');
+                addCurve({control, Point(args[0] + dx, args[1] + dy)});
+                break;
+            case 'A':{
+                // An arc with a zero radius is a line
+                if(args[0] == 0 || args[1] == 0){
+                    addCurve({Point(args[5] + dx, args[6] + dy)});
+                    break;
+                }
+                Point controls[12];
+                int segments = arcToCubics(temp, args[0], args[1], args[2],
+                    args[3] != 0, args[4] != 0,
+                    Point(args[5] + dx, args[6] + dy), controls);
+                for(int i = 0; i < segments; i++){
+                    addCurve({controls[3 * i], controls[3 * i + 1],
+                        controls[3 * i + 2]});
+                }
+                break;
+            }
+            case 'Z':
+                // A subpath is closed by a line back to its first point
+                if(split && !(temp == start)){
+                    addCurve({start});
+                }
+                temp = start;
                 break;
         }
+        previous = type;
     }
+}
+
+
+std::vector<PathPoints> FourierSeries::parseSVGSubpaths(std::string_view svg,
+    int workers) const {
 
-    return vectorOfPoints;
+    std::vector<std::string_view> paths = findPathData(svg);
+    std::vector<std::vector<PathPoints>> parsed(paths.size());
+
+    // Each path is parsed on its own, into its own list of subpaths
+    ThreadPool pool(workers);
+    for(int i = 0; i < paths.size(); i++){
+        pool.submit([this, &paths, &parsed, i]{
+            parsePathData(paths[i], parsed[i], true);
+        });
+    }
+    pool.wait();
+
+    std::vector<PathPoints> subpaths;
+    for(std::vector<PathPoints>& path : parsed){
+        for(PathPoints& subpath : path){
+            if(subpath.getCurveNumber() > 0){
+                subpaths.push_back(std::move(subpath));
+            }
+        }
+    }
+    return subpaths;
 }
 
 
+PathPoints FourierSeries::stitchSubpaths(
+    const std::vector<PathPoints>& subpaths) const {
+
+    PathPoints tour;
+    Point first, last;
+
+    for(const PathPoints& subpath : subpaths){
+        int curveNumber = subpath.getCurveNumber();
+        if(curveNumber == 0){
+            continue;
+        }
+
+        // A line joins the end of the previous subpath to this one's start
+        Point start = subpath.getCurve(0)[0];
+        if(tour.getCurveNumber() == 0){
+            first = start;
+        }
+        else if(!(last == start)){
+            tour.addPoint(last);
+            tour.addPoint(start);
+            tour.endCurve();
+        }
+
+        for(int i = 0; i < curveNumber; i++){
+            const Point* curve = subpath.getCurve(i);
+            for(int j = 0; j < subpath.getPointNumber(i); j++){
+                tour.addPoint(curve[j]);
+            }
+            tour.endCurve();
+        }
+        last = subpath.getCurve(curveNumber - 1)
+            [subpath.getPointNumber(curveNumber - 1) - 1];
+    }
+
+    // And a last line goes back to the start of the first
+    if(tour.getCurveNumber() > 0 && !(last == first)){
+        tour.addPoint(last);
+        tour.addPoint(first);
+        tour.endCurve();
+    }
+    return tour;
+}
+
 
 void FourierSeries::movePointsToMinimizeDistance(
     std::vector<std::vector<Point>>& points
@@ -136,6 +473,27 @@ void FourierSeries::movePointsToMinimizeDistance(
 }
 
 
+void FourierSeries::movePointsToMinimizeDistance(PathPoints& points) const {
+    real minX = std::numeric_limits<real>::max();
+    real minY = std::numeric_limits<real>::max();
+    real maxX = std::numeric_limits<real>::lowest();
+    real maxY = std::numeric_limits<real>::lowest();
+
+    for(const Point& point : points.getPoints()){
+        minX = std::min(minX, point.getX());
+        minY = std::min(minY, point.getY());
+        maxX = std::max(maxX, point.getX());
+        maxY = std::max(maxY, point.getY());
+    }
+
+    // Centers the bounding box at the origin
+    Point offset(-(maxX + minX)/2, -(maxY + minY)/2);
+    for(Point& point : points.getPoints()){
+        point += offset;
+    }
+}
+
+
 real FourierSeries::findMaxAbsolutePoint(
     const std::vector<std::vector<Point>>& points
 ) const {
@@ -188,6 +546,22 @@ void FourierSeries::scalePoints(
 }
 
 
+void FourierSeries::scalePoints(PathPoints& points, real size) const {
+    real maxAbsolutePoint = 0;
+    for(const Point& point : points.getPoints()){
+        maxAbsolutePoint = std::max({maxAbsolutePoint, std::abs(point.getX()),
+            std::abs(point.getY())});
+    }
+
+    // The same scale as above, with 20% wiggle room
+    real scale = (size/2) / maxAbsolutePoint;
+    scale *= 0.8;
+    for(Point& point : points.getPoints()){
+        point *= scale;
+    }
+}
+
+
 BezierCurveVector FourierSeries::generateBezierCurveVector(
     std::vector<std::vector<Point>> points
 ) const {
@@ -205,30 +579,309 @@ BezierCurveVector FourierSeries::generateBezierCurveVector(
 }
 
 
+BezierCurveVector FourierSeries::generateBezierCurveVector(
+    const PathPoints& points) const {
+
+    BezierCurveVector vector(1.0 / points.getCurveNumber());
+    for(int i = 0; i < points.getCurveNumber(); i++){
+        vector.addBezierCurve(points.getCurve(i), points.getPointNumber(i));
+    }
+    return vector;
+}
+
+
+std::vector<BezierCurveVector> FourierSeries::generateBezierCurveVectors(
+    std::vector<PathPoints>& subpaths, real size, int workers) const {
+
+    /**************************************************************************
+     * The subpaths are moved and scaled together, like the points of a
+     * single path, so that they keep their places relative to each other.
+    **************************************************************************/
+    real minX = std::numeric_limits<real>::max();
+    real minY = std::numeric_limits<real>::max();
+    real maxX = std::numeric_limits<real>::lowest();
+    real maxY = std::numeric_limits<real>::lowest();
+    for(const PathPoints& subpath : subpaths){
+        for(const Point& point : subpath.getPoints()){
+            minX = std::min(minX, point.getX());
+            minY = std::min(minY, point.getY());
+            maxX = std::max(maxX, point.getX());
+            maxY = std::max(maxY, point.getY());
+        }
+    }
+    Point offset(-(maxX + minX)/2, -(maxY + minY)/2);
+
+    // Once centered, the furthest point is half the larger side away
+    real scale = (size/2) / (std::max(maxX - minX, maxY - minY) / 2);
+    scale *= 0.8;
+
+    std::vector<BezierCurveVector> vectors(subpaths.size());
+    ThreadPool pool(workers);
+    for(int i = 0; i < subpaths.size(); i++){
+        pool.submit([this, &subpaths, &vectors, offset, scale, i]{
+            for(Point& point : subpaths[i].getPoints()){
+                point += offset;
+                point *= scale;
+            }
+            vectors[i] = generateBezierCurveVector(subpaths[i]);
+        });
+    }
+    pool.wait();
+    return vectors;
+}
+
+
 std::vector<ComplexNumber> FourierSeries::generateCircles(real dt, int n,
     const BezierCurveVector& h) const {
 
+    return generateCircles(dt, n, h, IntegrationMethod::RIEMANN_SUM);
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCircles(real dt, int n,
+    const BezierCurveVector& h, IntegrationMethod method) const {
+
+    return generateCircles(n, h, IntegrationPolicy(method, dt));
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCircles(real dt, int n,
+    const BezierCurveVector& h, IntegrationMethod method, int workers) const {
+
+    return generateCircles(n, h, IntegrationPolicy(method, dt), workers);
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCircles(int n,
+    const BezierCurveVector& h, const IntegrationPolicy& policy) const {
+
+    real dt = policy.getDt();
+
+    if(policy.getMethod() == IntegrationMethod::FFT){
+        return generateCirclesFFT(dt, n, h);
+    }
+
+    /**************************************************************************
+     * The circles at indices 0 to n - 1 need the integrals for n from 
+     * -(n / 2) to (n - 1) / 2, which one pass computes together.
+    **************************************************************************/
+    if(policy.getMethod() == IntegrationMethod::RIEMANN_SUM){
+        int nMin = -(n / 2);
+        return orderCircles(h.integrateAll(dt, nMin, (n - 1) / 2), nMin, n);
+    }
+
     std::vector<ComplexNumber> circles;
-    // First generates the circle with rotation speed 0.
-    ComplexNumber c = h.integrate(dt, 0);
-    circles.push_back(c);
-
-    for(int i = 1; i < n; i++){
-        if(i % 2 == 1){
-            /******************************************************************
-             * Odd complex coefficients are c[1], c[2] ... which need -1 and
-             * -2 as n to cancel the vector's movement and get its value.
-            ******************************************************************/
-            c = h.integrate(dt , -(i/2 + 1));
-        }
-        else if(i % 2 == 0){
-            /******************************************************************
-             * Even complex coefficients are c[-1], c[-2] ... which need 1
-             * and 2 as n to cancel the vector's movement and get its value.
-            ******************************************************************/
-            c = h.integrate(dt, i/2);
-        }
-        circles.push_back(c);
+    circles.reserve(n);
+    for(int i = 0; i < n; i++){
+        circles.push_back(generateCircle(i, h, policy));
+    }
+    return circles;
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCircles(int n,
+    const BezierCurveVector& h, const IntegrationPolicy& policy,
+    int workers) const {
+
+    real dt = policy.getDt();
+
+    if(policy.getMethod() == IntegrationMethod::FFT){
+        return generateCirclesFFT(dt, n, h);
     }
+
+    ThreadPool pool(workers);
+
+    // The pool splits the curves, and each batch does every frequency
+    if(policy.getMethod() == IntegrationMethod::RIEMANN_SUM){
+        int nMin = -(n / 2);
+        return orderCircles(h.integrateAll(dt, nMin, (n - 1) / 2, pool),
+            nMin, n);
+    }
+
+    /**************************************************************************
+     * Several batches per worker, so that there is still work left to
+     * steal when a worker finishes its own early.
+    **************************************************************************/
+    std::vector<ComplexNumber> circles(n);
+    int batchSize = std::max(1, n / (pool.getWorkerCount() * 8));
+
+    for(int start = 0; start < n; start += batchSize){
+        int end = std::min(n, start + batchSize);
+        pool.submit([this, &circles, &h, &policy, start, end]{
+            for(int i = start; i < end; i++){
+                circles[i] = generateCircle(i, h, policy);
+            }
+        });
+    }
+    pool.wait();
     return circles;
-}
\ No newline at end of file
+}
+
+
+std::vector<ComplexNumber> FourierSeries::orderCircles(
+    const std::vector<ComplexNumber>& integrals, int nMin, int count) const {
+
+    std::vector<ComplexNumber> circles(count);
+    for(int j = 0; j < integrals.size(); j++){
+        int frequency = nMin + j;
+        /**********************************************************************
+         * The inverse of getFrequency, n = -k is the circle at odd index
+         * 2k - 1, and n = k the one at even index 2k.
+        **********************************************************************/
+        int index = (frequency < 0) ? -2 * frequency - 1 : 2 * frequency;
+        if(index < count){
+            circles[index] = integrals[j];
+        }
+    }
+    return circles;
+}
+
+
+int FourierSeries::getFrequency(int index) {
+    // The first circle has rotation speed 0.
+    if(index == 0){
+        return 0;
+    }
+    else if(index % 2 == 1){
+        /**********************************************************************
+         * Odd complex coefficients are c[1], c[2] ... which need -1 and
+         * -2 as n to cancel the vector's movement and get its value.
+        **********************************************************************/
+        return -(index/2 + 1);
+    }
+    else{
+        /**********************************************************************
+         * Even complex coefficients are c[-1], c[-2] ... which need 1
+         * and 2 as n to cancel the vector's movement and get its value.
+        **********************************************************************/
+        return index/2;
+    }
+}
+
+
+ComplexNumber FourierSeries::generateCircle(int index,
+    const BezierCurveVector& h, const IntegrationPolicy& policy) const {
+
+    return h.integrate(policy, getFrequency(index));
+}
+
+
+std::vector<std::vector<ComplexNumber>> FourierSeries::generateCircles(
+    int n, const std::vector<BezierCurveVector>& paths,
+    const IntegrationPolicy& policy, int workers) const {
+
+    std::vector<std::vector<ComplexNumber>> circles(paths.size());
+    ThreadPool pool(workers);
+    for(int i = 0; i < paths.size(); i++){
+        pool.submit([this, &circles, &paths, &policy, n, i]{
+            circles[i] = generateCircles(n, paths[i], policy);
+        });
+    }
+    pool.wait();
+    return circles;
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCircles(int n,
+    const BezierCurveVector& h, real tolerance,
+    std::vector<real>& errors) const {
+
+    std::vector<ComplexNumber> circles(n);
+    errors.assign(n, 0);
+    for(int i = 0; i < n; i++){
+        circles[i] = h.integrateAdaptive(tolerance, getFrequency(i), 
+            errors[i]);
+    }
+    return circles;
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCircles(int n,
+    const BezierCurveVector& h, real tolerance, std::vector<real>& errors,
+    int workers) const {
+
+    std::vector<ComplexNumber> circles(n);
+    errors.assign(n, 0);
+    ThreadPool pool(workers);
+
+    // Small batches, since the fast circles cost more than the slow ones
+    int batchSize = std::max(1, n / (pool.getWorkerCount() * 8));
+    for(int start = 0; start < n; start += batchSize){
+        int end = std::min(n, start + batchSize);
+        pool.submit([this, &circles, &errors, &h, tolerance, start, end]{
+            for(int i = start; i < end; i++){
+                circles[i] = h.integrateAdaptive(tolerance, getFrequency(i),
+                    errors[i]);
+            }
+        });
+    }
+    pool.wait();
+    return circles;
+}
+
+
+std::vector<ComplexNumber> FourierSeries::generateCirclesFFT(real dt, int n,
+    const BezierCurveVector& h) const {
+
+    if(std::abs(h.getDuration() - 1) > 1e-9){
+        throw std::invalid_argument(
+            "The curves must be defined between t = 0 and t = 1");
+    }
+
+    /**************************************************************************
+     * There must be a sample per frequency at least, or the high positive
+     * and negative speeds would overlap in the transform.
+    **************************************************************************/
+    int size = std::max(static_cast<int>(std::ceil(1 / dt)), n + 1);
+    size = FastFourierTransform::nextPowerOfTwo(size);
+
+    std::vector<ComplexNumber> samples = h.sample(size);
+    FastFourierTransform::forward(samples);
+
+    std::vector<ComplexNumber> circles(n);
+    for(int i = 0; i < n; i++){
+        // Odd circles spin at (i + 1) / 2, even ones at -i / 2
+        int k = (i % 2 == 1) ? (i + 1) / 2 : size - i / 2;
+        circles[i] = samples[k % size] / size;
+    }
+    return circles;
+}
+
+std::vector<ComplexNumber> FourierSeries::reconstructPath(
+    const std::vector<ComplexNumber>& circles, int m) const {
+
+    if(m <= 0){
+        throw std::invalid_argument("The number of points must be positive");
+    }
+
+    /**************************************************************************
+     * The circle spinning at speed k adds c * e^(2 * pi * i * k * j / m) to
+     * point j, which is the inverse transform of c placed at k modulo m.
+    **************************************************************************/
+    std::vector<ComplexNumber> path(m);
+    for(int i = 0; i < circles.size(); i++){
+        int k = -getFrequency(i) % m;
+        path[k < 0 ? k + m : k] += circles[i];
+    }
+    FastFourierTransform::inverse(path);
+    return path;
+}
+
+
+real FourierSeries::findReconstructionError(
+    const std::vector<ComplexNumber>& circles, const BezierCurveVector& h,
+    int m) const {
+
+    if(std::abs(h.getDuration() - 1) > 1e-9){
+        throw std::invalid_argument(
+            "The curves must be defined between t = 0 and t = 1");
+    }
+
+    std::vector<ComplexNumber> path = reconstructPath(circles, m);
+    std::vector<ComplexNumber> samples = h.sample(m);
+    real error{0};
+    for(int j = 0; j < m; j++){
+        error = std::max(error, (path[j] - samples[j]).getMagnitude());
+    }
+    return error;
+}
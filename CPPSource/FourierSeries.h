@@ -24,25 +24,79 @@
 #include <fstream>
 #include <vector>
 #include <sstream>
+#include <cctype>
+#include <string_view>
 #include <algorithm>
 #include <limits>
 #include "BezierCurveVector.h"
+#include "MappedFile.h"
+#include "PathPoints.h"
+#include "SVGPathTokenizer.h"
+#include "FastFourierTransform.h"
+#include "ThreadPool.h"
 
 namespace fs{
 
     class FourierSeries{
+    private:
+
+        /**********************************************************************
+         * Integrates the circle at the given index of the array returned
+         * by generateCircles.
+        **********************************************************************/
+        ComplexNumber generateCircle(int index, const BezierCurveVector& h,
+            const IntegrationPolicy& policy) const;
+
+        /**********************************************************************
+         * Takes the integrals for n = nMin, nMin + 1 ... and places each at
+         * the index of the circle it belongs to, the integral for n being
+         * the circle spinning at speed -n. Returns the first count circles.
+        **********************************************************************/
+        std::vector<ComplexNumber> orderCircles(
+            const std::vector<ComplexNumber>& integrals, int nMin,
+            int count) const;
+
+        /**********************************************************************
+         * Parses path data into the last PathPoints of subpaths, adding one
+         * if there are none, in a single pass over the characters. With
+         * split, each M after the first curves starts a new PathPoints, and
+         * z closes the subpath with a line back to its first point if it
+         * isn't there already. Without it, this is parseSVGPath, and z only
+         * moves the current point back to the start of the subpath.
+        **********************************************************************/
+        void parsePathData(std::string_view pathData,
+            std::vector<PathPoints>& subpaths, bool split) const;
+
     public:
 
         // No arg constructor
         FourierSeries();
 
+        /**********************************************************************
+         * Returns the n to integrate with to get the circle at the given
+         * index of the array returned by generateCircles, where index 0
+         * spins at a speed of 0, odd indices at 1, 2 ... and even indices
+         * at -1, -2 ... The circle spinning at speed k needs n = -k.
+        **********************************************************************/
+        static int getFrequency(int index);
+
         /**********************************************************************
          * This function loads an svg file, and extracts the first svg path
          * element if it exists. Returns the path starting with M and ending
          * with z if it exists, or an empty string otherwise.
+         * The file is mapped rather than read, so only the path is copied.
         **********************************************************************/
         std::string parseSVG(const std::string& filePath) const;
 
+        /**********************************************************************
+         * Returns the d attribute of every path element in the contents of
+         * an svg file, in order, as views into the contents, so nothing is
+         * copied. Used with a MappedFile, the paths are parsed straight from
+         * the mapped bytes, and stay valid for as long as the file is.
+        **********************************************************************/
+        std::vector<std::string_view> findPathData(std::string_view svg)
+            const;
+
         /**********************************************************************
          * This function returns a vector of vectors of points, where each
          * vector contains the start, end, and control points of a bezier
@@ -52,10 +106,43 @@ namespace fs{
          * commands used in an svg file, including M, for the initial point,
          * L for a line, Q and C for quadratic and cubic curves, and z, for
          * the end of the curve back at the start (forming a loop).
+         * The whole path grammar is understood: the lower case commands,
+         * whose points are relative to the current point, the H and V
+         * lines, the S and T curves, whose first control point reflects
+         * the last one, commands repeated by giving more numbers, and A,
+         * whose elliptical arcs are converted to cubic curves.
         **********************************************************************/
         std::vector<std::vector<Point>> parseSVGPath(
-            const std::string& pathData
-        ) const;        
+            std::string_view pathData
+        ) const;
+
+        /**********************************************************************
+         * Parses the same curves as the function above, but adds their
+         * points to curves, all in one array, instead of allocating a vector
+         * for each curve. The path is read in a single pass by an
+         * SVGPathTokenizer, and parsing stops at a command missing numbers.
+        **********************************************************************/
+        void parseSVGPath(std::string_view pathData, PathPoints& curves)
+            const;
+
+        /**********************************************************************
+         * Returns every subpath of every path element in the contents of an
+         * svg file, in order. A new subpath starts at each M command, and z
+         * closes it with a line back to its start. The paths are parsed
+         * concurrently on the given number of workers (0 for one per
+         * hardware thread).
+        **********************************************************************/
+        std::vector<PathPoints> parseSVGSubpaths(std::string_view svg,
+            int workers) const;
+
+        /**********************************************************************
+         * Joins subpaths, in order, into a single closed tour, with a line
+         * from the end of each subpath to the start of the next, and one
+         * from the end of the last back to the start of the first. The
+         * tour can be drawn by a single Fourier series.
+        **********************************************************************/
+        PathPoints stitchSubpaths(const std::vector<PathPoints>& subpaths)
+            const;        
         
         /**********************************************************************
          * Moves the points so that the image fits in the smallest possible
@@ -66,6 +153,9 @@ namespace fs{
             std::vector<std::vector<Point>>& points
         ) const;
 
+        // Same as the function above, for the points of a PathPoints
+        void movePointsToMinimizeDistance(PathPoints& points) const;
+
         /**********************************************************************
          * Returns the further point from the origin (be it along the x or y
          * axis). Used in order to scale the image to fit into the canvas.
@@ -81,6 +171,9 @@ namespace fs{
         void scalePoints(std::vector<std::vector<Point>>& points,
             real size) const;
 
+        // Same as the function above, for the points of a PathPoints
+        void scalePoints(PathPoints& points, real size) const;
+
         /**********************************************************************
          * Given a vector of vectors of points, where each vector correpsonds
          * to the points defining a bezier curve, and the point at the end of
@@ -91,6 +184,21 @@ namespace fs{
         BezierCurveVector generateBezierCurveVector(
             std::vector<std::vector<Point>> points
         ) const;
+
+        // Same as the function above, for the curves of a PathPoints
+        BezierCurveVector generateBezierCurveVector(const PathPoints& points)
+            const;
+
+        /**********************************************************************
+         * Moves and scales subpaths together to fit a canvas of the given
+         * size, like movePointsToMinimizeDistance and scalePoints do for a
+         * single path, and returns a separate BezierCurveVector for each,
+         * which can then be drawn by Fourier series of their own. The
+         * subpaths are processed concurrently on the given number of
+         * workers (0 for one per hardware thread).
+        **********************************************************************/
+        std::vector<BezierCurveVector> generateBezierCurveVectors(
+            std::vector<PathPoints>& subpaths, real size, int workers) const;
       
         /**********************************************************************
          * Given a bezier curve vector, integrates it (between the 0 and the
@@ -108,6 +216,121 @@ namespace fs{
         **********************************************************************/ 
         std::vector<ComplexNumber> generateCircles(real dt, int n,
             const BezierCurveVector& h) const;
+
+        /**********************************************************************
+         * Generates the same circles as the function above, but integrates
+         * each of them using the given integration method.
+         * With IntegrationMethod::EXACT, dt is ignored and the coefficients
+         * are computed in closed form, and with IntegrationMethod::FFT,
+         * all of them come from generateCirclesFFT.
+         * With IntegrationMethod::RIEMANN_SUM, all the circles are
+         * integrated together in one pass by BezierCurveVector::integrateAll.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCircles(real dt, int n,
+            const BezierCurveVector& h, IntegrationMethod method) const;
+
+        /**********************************************************************
+         * Generates the same circles as the function above, but splits the
+         * indices into small batches integrated concurrently by a pool of
+         * the given number of workers (0 for one per hardware thread).
+         * Idle workers steal batches from busy ones, so the load stays
+         * balanced even when some coefficients cost more than others.
+         * Each circle is written at its own index, so the result is the
+         * same as the serial function's. For the Riemann sum, the workers
+         * instead split the curves, each batch integrating every frequency
+         * over its own curves with integrateAll, so that every sample is
+         * still evaluated only once.
+         * The FFT method computes all circles in a single transform, so it
+         * ignores the workers.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCircles(real dt, int n,
+            const BezierCurveVector& h, IntegrationMethod method,
+            int workers) const;
+
+        /**********************************************************************
+         * Generates the same circles as the functions above, using the
+         * method and parameters of the given policy, which is the only way
+         * to choose the order of IntegrationMethod::GAUSS_LEGENDRE.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCircles(int n,
+            const BezierCurveVector& h, const IntegrationPolicy& policy) const;
+
+        /**********************************************************************
+         * Generates the same circles as the function above, concurrently
+         * on the given number of workers, like the overload taking a
+         * method and workers.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCircles(int n,
+            const BezierCurveVector& h, const IntegrationPolicy& policy,
+            int workers) const;
+
+        /**********************************************************************
+         * Generates n circles for each of several paths, such as those of
+         * generateBezierCurveVectors, the paths being integrated concurrently
+         * on the given number of workers (0 for one per hardware thread).
+        **********************************************************************/
+        std::vector<std::vector<ComplexNumber>> generateCircles(int n,
+            const std::vector<BezierCurveVector>& paths,
+            const IntegrationPolicy& policy, int workers) const;
+
+        /**********************************************************************
+         * Generates the same circles as the functions above, adaptively,
+         * so that each one is within an absolute error of tolerance,
+         * instead of relying on a step size.
+         * The estimated error of each circle is written to the same index
+         * of errors, which is resized to n.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCircles(int n,
+            const BezierCurveVector& h, real tolerance,
+            std::vector<real>& errors) const;
+
+        /**********************************************************************
+         * Generates the same circles and errors as the function above,
+         * concurrently on the given number of workers. The cost of adaptive
+         * integration grows with the speed of the circle, which the work
+         * stealing of the pool evens out.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCircles(int n,
+            const BezierCurveVector& h, real tolerance,
+            std::vector<real>& errors, int workers) const;
+
+        /**********************************************************************
+         * Generates the n circles from a single Fourier transform.
+         * The curves are sampled once on a uniform grid of S points, where
+         * S is the smallest power of two with a step no larger than dt and
+         * enough points to hold n frequencies. The coefficient spinning at
+         * speed k is then the kth transformed value divided by S, and the
+         * one spinning at -k is the (S - k)th. They are reordered as
+         * 0, 1, -1, 2, -2, etc... to match generateCircles.
+         * The curves must be defined from t = 0 to t = 1, which is what
+         * generateBezierCurveVector produces, since the frequencies of the
+         * transform are only whole numbers of turns over a period of 1.
+        **********************************************************************/ 
+        std::vector<ComplexNumber> generateCirclesFFT(real dt, int n,
+            const BezierCurveVector& h) const;
+
+        /**********************************************************************
+         * Returns the points drawn by the tip of the circles at the m evenly
+         * spaced times t = j / m for j = 0 to m - 1, over a period of 1.
+         * Instead of summing all the circles at each time, each circle is
+         * added to the frequency it spins at, and a single inverse Fourier
+         * transform of size m gives every point at once. Circles spinning
+         * faster than the m points can tell apart fold onto the same
+         * frequency, which still gives exact points at those times.
+        **********************************************************************/
+        std::vector<ComplexNumber> reconstructPath(
+            const std::vector<ComplexNumber>& circles, int m) const;
+
+        /**********************************************************************
+         * Returns the largest distance between the path drawn by the
+         * circles and the curves they were generated from, at the m times
+         * used by reconstructPath.
+         * The curves must be defined from t = 0 to t = 1. Near a jump in
+         * the path, such as the end of a path that isn't a loop, the
+         * circles overshoot, so the error stays large there.
+        **********************************************************************/
+        real findReconstructionError(const std::vector<ComplexNumber>& circles,
+            const BezierCurveVector& h, int m) const;
     };
 }
 
@@ -0,0 +1,167 @@
+/******************************************************************************
+ * Source file for the FourierSession class member functions.
+******************************************************************************/
+
+#include "FourierSession.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+FourierSession::FourierSession(const BezierCurveVector& h, int n,
+    const IntegrationPolicy& policy, int workers) : path{h},
+    policy{policy}, edits{0} {
+
+    if(h.getBezierCurveNumber() == 0){
+        throw std::invalid_argument("The path has no curves");
+    }
+    if(n < 0){
+        throw std::invalid_argument("The number of circles can't be negative");
+    }
+
+    contributions.assign(path.getBezierCurveNumber(),
+        std::vector<ComplexNumber>(n));
+    circles.resize(n);
+
+    // The curves are independent, so they are integrated concurrently
+    ThreadPool pool(workers);
+    for(int i = 0; i < path.getBezierCurveNumber(); i++){
+        pool.submit([this, i]{
+            generateContribution(i);
+        });
+    }
+    pool.wait();
+    resum();
+}
+
+
+// Generate contribution function definition
+void FourierSession::generateContribution(int curve){
+    std::vector<ComplexNumber>& contribution = contributions[curve];
+    for(int i = 0; i < contribution.size(); i++){
+        contribution[i] = path.integrateCurve(curve, policy,
+            FourierSeries::getFrequency(i));
+    }
+}
+
+
+// Update contribution function definition
+void FourierSession::updateContribution(int curve){
+    std::vector<ComplexNumber>& contribution = contributions[curve];
+    for(int i = 0; i < contribution.size(); i++){
+        ComplexNumber value = path.integrateCurve(curve, policy,
+            FourierSeries::getFrequency(i));
+        circles[i] += value - contribution[i];
+        contribution[i] = value;
+    }
+}
+
+
+// Resum function definition
+void FourierSession::resum(){
+    std::fill(circles.begin(), circles.end(), ComplexNumber());
+    for(const std::vector<ComplexNumber>& contribution : contributions){
+        for(int i = 0; i < circles.size(); i++){
+            circles[i] += contribution[i];
+        }
+    }
+    edits = 0;
+}
+
+
+// Get circles function definition
+const std::vector<ComplexNumber>& FourierSession::getCircles() const{
+    return circles;
+}
+
+
+// Get Bezier curve number function definition
+int FourierSession::getBezierCurveNumber() const{
+    return path.getBezierCurveNumber();
+}
+
+
+// Get Bezier curve function definition
+BezierCurve FourierSession::getBezierCurve(int curve) const{
+    if(curve < 0 || curve >= path.getBezierCurveNumber()){
+        throw std::out_of_range("The curve does not exist");
+    }
+    return path.getBezierCurve(curve);
+}
+
+
+// Is closed function definition
+bool FourierSession::isClosed() const{
+    /**************************************************************************
+     * In a closed path, such as the tour of FourierSeries::stitchSubpaths,
+     * the first curve starts where the last one ends, so they are
+     * neighbours too. This is checked before an edit moves either point.
+    **************************************************************************/
+    int last = path.getBezierCurveNumber() - 1;
+    return last > 0 && path.getPoint(0, 0)
+        == path.getPoint(last, path.getPointNumber(last) - 1);
+}
+
+
+// Set points function definition
+void FourierSession::setPoints(int curve,
+    const std::vector<Point>& points){
+
+    if(curve < 0 || curve >= path.getBezierCurveNumber()){
+        throw std::out_of_range("The curve does not exist");
+    }
+    if(points.empty()){
+        throw std::invalid_argument("A curve must have at least one point");
+    }
+
+    bool closed = isClosed();
+    path.setPoints(curve, points.data(), points.size());
+    finishEdit(curve, closed);
+}
+
+
+// Move point function definition
+void FourierSession::movePoint(int curve, int index, const Point& point){
+    if(curve < 0 || curve >= path.getBezierCurveNumber()){
+        throw std::out_of_range("The curve does not exist");
+    }
+    if(index < 0 || index >= path.getPointNumber(curve)){
+        throw std::out_of_range("The point does not exist");
+    }
+
+    bool closed = isClosed();
+    path.setPoint(curve, index, point);
+    finishEdit(curve, closed);
+}
+
+
+// Finish edit function definition
+void FourierSession::finishEdit(int curve, bool closed){
+    updateContribution(curve);
+
+    // The neighbours share the end points, so they follow them
+    int size = path.getBezierCurveNumber();
+    if(curve > 0 || closed){
+        int before = (curve - 1 + size) % size;
+        followPoint(before, path.getPointNumber(before) - 1,
+            path.getPoint(curve, 0));
+    }
+    if(curve + 1 < size || closed){
+        followPoint((curve + 1) % size, 0,
+            path.getPoint(curve, path.getPointNumber(curve) - 1));
+    }
+
+    if(++edits >= RESUMMATION_PERIOD){
+        resum();
+    }
+}
+
+
+// Follow point function definition
+void FourierSession::followPoint(int curve, int index, const Point& point){
+    if(path.getPoint(curve, index) == point){
+        return;
+    }
+    path.setPoint(curve, index, point);
+    updateContribution(curve);
+}
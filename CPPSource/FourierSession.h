@@ -0,0 +1,130 @@
+/******************************************************************************
+ * FourierSession.h
+ * Header file for the FourierSession class, which keeps the circles of a
+ * Fourier series up to date while the curves of its path are edited.
+ * A Fourier coefficient is an integral over the whole path, which is the
+ * sum of the integrals over each of its curves. The session keeps the
+ * contribution of every curve to every circle, so that when a curve is
+ * edited, only that curve is integrated again, and the circles are moved
+ * by the difference between its new and old contributions, instead of
+ * integrating every curve of the path again.
+******************************************************************************/
+
+#ifndef FOURIER_SESSION_H
+#define FOURIER_SESSION_H
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "BezierCurve.h"
+#include "BezierCurveVector.h"
+#include "FourierSeries.h"
+#include "ComplexNumber.h"
+#include "IntegrationPolicy.h"
+#include "ThreadPool.h"
+#include "Point.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * FourierSession class definition.
+     * The circles are in the order generateCircles returns them. The path
+     * is kept as a BezierCurveVector, so an edit rewrites the points and
+     * coefficients of a curve in its slot, and each contribution is
+     * integrated with integrateCurve and the session's policy, none of
+     * which allocates. IntegrationMethod::FFT, which only exists for a
+     * whole path, falls back to a Riemann sum. EXACT is the best
+     * suited, since an edit then costs a few closed forms per circle.
+     * Adding the differences one after the other slowly lets rounding
+     * errors build up in the circles, so every few edits they are summed
+     * again from the contributions, like AnimationEngine does for its
+     * rotations.
+    **************************************************************************/
+    class FourierSession{
+    public:
+
+        // Edits after which the circles are summed again from scratch
+        static constexpr int RESUMMATION_PERIOD = 1024;
+
+    private:
+
+        BezierCurveVector path;             // Curves of the path
+        IntegrationPolicy policy;           // How the curves are integrated
+
+        // Contribution of each curve to each circle, by curve then circle
+        std::vector<std::vector<ComplexNumber>> contributions;
+
+        std::vector<ComplexNumber> circles;     // Sums of the contributions
+        int edits;          // Edits since the circles were last summed
+
+        // Integrates every circle of a curve into its contributions
+        void generateContribution(int curve);
+
+        // Integrates a curve again, and adds the change to the circles
+        void updateContribution(int curve);
+
+        // Sums the circles again from the contributions
+        void resum();
+
+        // Whether the last curve ends where the first one starts
+        bool isClosed() const;
+
+        /**********************************************************************
+         * Moves the point at index of a curve next to an edited one, onto
+         * the end point they share, and updates that curve. Nothing is
+         * integrated again if the point is already there.
+        **********************************************************************/
+        void followPoint(int curve, int index, const Point& point);
+
+        /**********************************************************************
+         * Updates an edited curve, then makes its neighbours follow its end
+         * points, the first and last curves being neighbours if closed.
+        **********************************************************************/
+        void finishEdit(int curve, bool closed);
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the path, the number of circles, and
+         * how to integrate them. The contributions of the curves are
+         * integrated on the given number of workers (0 for one per hardware
+         * thread). Throws an invalid argument error if the path is empty or
+         * n is negative.
+        **********************************************************************/
+        FourierSession(const BezierCurveVector& h, int n,
+            const IntegrationPolicy& policy, int workers);
+
+        // Returns the circles of the path as it is now
+        const std::vector<ComplexNumber>& getCircles() const;
+
+        // Getter for the number of curves
+        int getBezierCurveNumber() const;
+
+        /**********************************************************************
+         * Returns a curve of the path by value, since the path doesn't
+         * store BezierCurve objects. Throws an out of range error if it
+         * doesn't exist.
+        **********************************************************************/
+        BezierCurve getBezierCurve(int curve) const;
+
+        /**********************************************************************
+         * Replaces the control points of a curve, which keeps its time range.
+         * The path stays continuous: if the first or last point moves, so
+         * does the last point of the curve before it or the first point of
+         * the one after it, and that curve is updated too. If the path is
+         * closed, the first and last curves are neighbours.
+         * Nothing is allocated unless the number of points changes.
+         * Throws an out of range error if the curve doesn't exist, and an
+         * invalid argument error if there are no points.
+        **********************************************************************/
+        void setPoints(int curve, const std::vector<Point>& points);
+
+        /**********************************************************************
+         * Moves one control point of a curve, with the same rules as
+         * setPoints. Throws an out of range error if the point doesn't exist.
+        **********************************************************************/
+        void movePoint(int curve, int index, const Point& point);
+    };
+}
+
+#endif
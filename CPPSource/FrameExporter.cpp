@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Source file for the FrameExporter class member functions.
+******************************************************************************/
+
+#include "FrameExporter.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+FrameExporter::FrameExporter(int canvasSize, bool showCircles,
+    real minimumRadius, int workers) : canvasSize{canvasSize},
+    showCircles{showCircles}, minimumRadius{minimumRadius},
+    workers{workers} {}
+
+
+// Export frames function definition
+void FrameExporter::exportFrames(const std::vector<ComplexNumber>& circles,
+    real angleStep, int frameCount,
+    const std::function<void(int, const Framebuffer&)>& write) const{
+
+    /**************************************************************************
+     * A worker starting in the middle of the animation needs the path
+     * traced before its first frame, so the tips of every frame are found
+     * first, which costs far less than drawing the frames.
+    **************************************************************************/
+    std::vector<ComplexNumber> tips(frameCount);
+    AnimationEngine stepper(circles, angleStep);
+    for(int frame = 0; frame < frameCount; frame++){
+        stepper.advance();
+        tips[frame] = stepper.getTip();
+    }
+
+    /**************************************************************************
+     * The workers claim small batches of frames in turn, so that the next
+     * frame to write is always close to being rendered, and a worker ahead
+     * of it has room in the queue instead of waiting on it.
+     * The pool is declared last, so that it is destroyed first, and its
+     * workers are joined before the queue they push to goes away.
+    **************************************************************************/
+    std::atomic<int> nextBatch{0};
+    int capacity = BATCH_SIZE * BATCHES_PER_WORKER * (workers > 0 ? workers
+        : std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+    ReorderQueue<Framebuffer> queue(capacity);
+    ThreadPool pool(workers);
+
+    for(int worker = 0; worker < pool.getWorkerCount(); worker++){
+        pool.submit([&]{
+            try{
+                AnimationEngine engine(circles, angleStep);
+                HeadlessRenderer renderer(canvasSize, minimumRadius);
+                int traced = 0;     // Frames whose tip has been traced
+
+                /**************************************************************
+                 * The batches are claimed in increasing order, so the frame
+                 * the queue waits for always belongs to a worker that isn't
+                 * waiting to push a later one.
+                **************************************************************/
+                while(true){
+                    int start = nextBatch.fetch_add(BATCH_SIZE);
+                    if(start >= frameCount){
+                        return;
+                    }
+                    int end = std::min(frameCount, start + BATCH_SIZE);
+
+                    for(; traced < start; traced++){
+                        renderer.traceTo(tips[traced]);
+                    }
+
+                    /**********************************************************
+                     * An engine set to a multiple of the resynchronization
+                     * period is in exactly the state of one that stepped
+                     * there, so the engine is set to the last one before
+                     * the batch, unless it is already past it, and stepped
+                     * to the batch. The frames then match those rendered
+                     * serially, and stepping costs far less than drawing.
+                    **********************************************************/
+                    const int period =
+                        AnimationEngine::RESYNCHRONIZATION_PERIOD;
+                    long long synchronized = start / period * period;
+                    if(engine.getFrame() < synchronized
+                        || engine.getFrame() > start){
+                        engine.setFrame(synchronized);
+                    }
+                    while(engine.getFrame() < start){
+                        engine.advance();
+                    }
+                    for(int frame = start; frame < end; frame++){
+                        engine.advance();
+                        const Framebuffer& image = renderer.render(engine,
+                            engine.getTotalAngle() < 2 * PI, showCircles);
+                        traced = frame + 1;
+                        if(!queue.push(frame, image)){
+                            return;
+                        }
+                    }
+                }
+            }
+            catch(...){
+                // Wakes the other threads so that they stop too
+                queue.close();
+                throw;
+            }
+        });
+    }
+
+    Framebuffer image(canvasSize, canvasSize);
+    try{
+        for(int frame = 0; frame < frameCount; frame++){
+            if(!queue.pop(image)){
+                break;
+            }
+            write(frame, image);
+        }
+    }
+    catch(...){
+        queue.close();
+        throw;
+    }
+
+    // Rethrows the exception of a worker that failed
+    pool.wait();
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * FrameExporter.h
+ * Header file for the FrameExporter class, which renders the frames of the
+ * animation on several threads for offline export.
+ * Each frame only depends on the circles and its index, so the frames are
+ * split into small batches that the workers of a ThreadPool render at the
+ * same time, each with its own engine and framebuffer. The finished frames go
+ * through a bounded ReorderQueue, from which they are handed out in order,
+ * so that only a few frames are ever held in memory at once.
+******************************************************************************/
+
+#ifndef FRAME_EXPORTER_H
+#define FRAME_EXPORTER_H
+
+#include <atomic>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include "ComplexNumber.h"
+#include "AnimationEngine.h"
+#include "HeadlessRenderer.h"
+#include "Framebuffer.h"
+#include "ReorderQueue.h"
+#include "ThreadPool.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * FrameExporter class definition.
+     * The frames are the same as those of HeadlessRenderer stepped one
+     * after the other: frame f shows the circles after f + 1 steps, and
+     * the chain is only shown during the first turn.
+    **************************************************************************/
+    class FrameExporter{
+    private:
+
+        int canvasSize;         // Size of the square frames in pixels
+        bool showCircles;       // Whether the circles are drawn
+        real minimumRadius;     // Radius below which circles aren't drawn
+        int workers;            // Number of threads, 0 for all cores
+
+        /**********************************************************************
+         * Frames a worker claims at once. The batches are kept small, since
+         * a worker can only be a few batches ahead of the frame written.
+        **********************************************************************/
+        static constexpr int BATCH_SIZE = 2;
+
+        /**********************************************************************
+         * Batches held at most by the reorder queue for each worker, enough
+         * for every worker to be a few batches ahead of the slowest one.
+        **********************************************************************/
+        static constexpr int BATCHES_PER_WORKER = 2;
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the size of the frames, whether to
+         * draw the circles, the radius in pixels below which a circle isn't
+         * drawn, and the number of threads, 0 or less using one per
+         * hardware thread.
+        **********************************************************************/
+        FrameExporter(int canvasSize, bool showCircles, real minimumRadius,
+            int workers);
+
+        /**********************************************************************
+         * Renders frameCount frames of the circles turning by angleStep
+         * times their speed per frame, and calls write with the index and
+         * image of each, in order, on the calling thread.
+         * If write or a worker throws, the export stops and the exception
+         * is rethrown.
+        **********************************************************************/
+        void exportFrames(const std::vector<ComplexNumber>& circles,
+            real angleStep, int frameCount,
+            const std::function<void(int, const Framebuffer&)>& write) const;
+    };
+}
+
+#endif
@@ -0,0 +1,218 @@
+/******************************************************************************
+ * Source file for the Framebuffer class member functions.
+******************************************************************************/
+
+#include "Framebuffer.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+Framebuffer::Framebuffer(int width, int height)
+    : width{width}, height{height} {
+    if(width <= 0 || height <= 0){
+        throw std::invalid_argument("The size must be positive");
+    }
+    pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+}
+
+
+// Width getter definition
+int Framebuffer::getWidth() const{
+    return width;
+}
+
+
+// Height getter definition
+int Framebuffer::getHeight() const{
+    return height;
+}
+
+
+// Data getter definition
+const std::uint8_t* Framebuffer::getData() const{
+    return pixels.data();
+}
+
+
+// Pixel getter definition
+Color Framebuffer::getPixel(int x, int y) const{
+    if(x < 0 || x >= width || y < 0 || y >= height){
+        throw std::out_of_range("The pixel does not exist");
+    }
+    const std::uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x)
+        * 4];
+    return Color{pixel[0], pixel[1], pixel[2], pixel[3]};
+}
+
+
+// Clear function definition
+void Framebuffer::clear(const Color& color){
+    for(size_t i = 0; i < pixels.size(); i += 4){
+        pixels[i] = color.r;
+        pixels[i + 1] = color.g;
+        pixels[i + 2] = color.b;
+        pixels[i + 3] = color.a;
+    }
+}
+
+
+// Blend pixel function definition
+void Framebuffer::blendPixel(int x, int y, const Color& color,
+    real coverage){
+
+    if(x < 0 || x >= width || y < 0 || y >= height || coverage <= 0){
+        return;
+    }
+
+    /**************************************************************************
+     * Source over blending: the color covers alpha of the pixel, and what
+     * was there shows through the rest.
+    **************************************************************************/
+    std::uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x) * 4];
+    real alpha = std::min<real>(coverage, 1) * color.a / 255;
+    real below = pixel[3] / 255.0 * (1 - alpha);
+    real result = alpha + below;
+    if(result <= 0){
+        return;
+    }
+
+    const std::uint8_t channels[3] = {color.r, color.g, color.b};
+    for(int c = 0; c < 3; c++){
+        real value = (channels[c] * alpha + pixel[c] * below) / result;
+        pixel[c] = static_cast<std::uint8_t>(value + 0.5);
+    }
+    pixel[3] = static_cast<std::uint8_t>(result * 255 + 0.5);
+}
+
+
+// Draw line function definition
+void Framebuffer::drawLine(real x0, real y0, real x1, real y1,
+    const Color& color){
+
+    /**************************************************************************
+     * The algorithm steps along x, so a steep line is drawn with x and y
+     * swapped, and the pixels are swapped back when plotted.
+    **************************************************************************/
+    bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+    if(steep){
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if(x0 > x1){
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    // Pixel centers are at half coordinates
+    x0 -= 0.5;
+    y0 -= 0.5;
+    x1 -= 0.5;
+    y1 -= 0.5;
+
+    auto plot = [&](int x, int y, real coverage){
+        if(steep){
+            blendPixel(y, x, color, coverage);
+        }
+        else{
+            blendPixel(x, y, color, coverage);
+        }
+    };
+
+    real dx = x1 - x0;
+    real gradient = (dx == 0) ? 1 : (y1 - y0) / dx;
+
+    // The ends only partly cover their columns
+    int startX = static_cast<int>(std::max<real>(std::round(x0), -2));
+    int endX = static_cast<int>(std::min<real>(std::round(x1), 1 << 30));
+    real startGap = 1 - (x0 + 0.5 - std::floor(x0 + 0.5));
+    real endGap = x1 + 0.5 - std::floor(x1 + 0.5);
+
+    // Columns outside the image are skipped, whatever the line's length
+    int limit = steep ? height : width;
+    int from = std::max(startX, -1);
+    int to = std::min(endX, limit);
+
+    for(int x = from; x <= to; x++){
+        real y = y0 + gradient * (x - x0);
+        int row = static_cast<int>(std::floor(y));
+        real fraction = y - row;
+        real gap = 1;
+        if(x == startX){
+            gap = (startX == endX) ? x1 - x0 : startGap;
+        }
+        else if(x == endX){
+            gap = endGap;
+        }
+        plot(x, row, (1 - fraction) * gap);
+        plot(x, row + 1, fraction * gap);
+    }
+}
+
+
+// Draw circle function definition
+void Framebuffer::drawCircle(real x, real y, real radius, real thickness,
+    const Color& color){
+
+    // Pixels within this distance of the circle are at least partly covered
+    real reach = thickness / 2 + 0.5;
+    real outer = radius + reach;
+    real inner = radius - reach;
+
+    int top = std::max(0, static_cast<int>(std::floor(y - outer)));
+    int bottom = std::min(height - 1, static_cast<int>(std::ceil(y + outer)));
+    for(int row = top; row <= bottom; row++){
+        real dy = row + 0.5 - y;
+        if(std::abs(dy) > outer){
+            continue;
+        }
+
+        /**********************************************************************
+         * The outline crosses the row in two spans, left and right of the
+         * center, between the inner and outer edge of the ring. When the
+         * row is above or below the inner edge, they join into one.
+        **********************************************************************/
+        real outerHalf = std::sqrt(outer * outer - dy * dy);
+        real innerHalf = (inner > 0 && std::abs(dy) < inner)
+            ? std::sqrt(inner * inner - dy * dy) : 0;
+
+        real spans[2][2] = {{x - outerHalf, x - innerHalf},
+            {x + innerHalf, x + outerHalf}};
+        int spanCount = 2;
+        if(innerHalf == 0){
+            spans[0][1] = spans[1][1];
+            spanCount = 1;
+        }
+
+        for(int span = 0; span < spanCount; span++){
+            int first = std::max(0,
+                static_cast<int>(std::floor(spans[span][0])));
+            int last = std::min(width - 1,
+                static_cast<int>(std::floor(spans[span][1])));
+            for(int column = first; column <= last; column++){
+                real dx = column + 0.5 - x;
+                real distance = std::sqrt(dx * dx + dy * dy);
+                blendPixel(column, row, color,
+                    reach - std::abs(distance - radius));
+            }
+        }
+    }
+}
+
+
+// Draw layer function definition
+void Framebuffer::draw(const Framebuffer& layer){
+    if(layer.width != width || layer.height != height){
+        throw std::invalid_argument("The images must be the same size");
+    }
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            const std::uint8_t* pixel = &layer.pixels[
+                (static_cast<size_t>(y) * width + x) * 4];
+            if(pixel[3] != 0){
+                blendPixel(x, y, Color{pixel[0], pixel[1], pixel[2],
+                    pixel[3]}, 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Framebuffer.h
+ * Header file for the Framebuffer class, an image held in memory that
+ * lines and circles can be drawn into without a window or a GPU.
+ * The shapes are anti-aliased: a pixel the shape only partly covers is
+ * blended with the shape's color in proportion to how much of it is
+ * covered, which is what makes the edges look smooth.
+******************************************************************************/
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * Color of a pixel, with 8 bits per channel. a is the opacity, 255
+     * being fully opaque.
+    **************************************************************************/
+    struct Color{
+        std::uint8_t r;
+        std::uint8_t g;
+        std::uint8_t b;
+        std::uint8_t a;
+    };
+
+    /**************************************************************************
+     * Framebuffer class definition.
+     * The pixels are stored row by row, from the top left, with 4 bytes
+     * each in RGBA order, so the data can be written out as is.
+     * Shapes are given in pixel coordinates, where the center of the top
+     * left pixel is (0.5, 0.5), and the parts outside the image are
+     * clipped.
+    **************************************************************************/
+    class Framebuffer{
+    private:
+
+        int width;                          // Width in pixels
+        int height;                         // Height in pixels
+        std::vector<std::uint8_t> pixels;   // RGBA bytes of all the pixels
+
+        /**********************************************************************
+         * Blends a color over the pixel at (x, y), scaling its opacity by
+         * coverage, the fraction of the pixel covered from 0 to 1.
+         * Pixels outside the image are ignored.
+        **********************************************************************/
+        void blendPixel(int x, int y, const Color& color, real coverage);
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, the image starts out fully transparent.
+         * Throws an invalid argument error if a size is not positive.
+        **********************************************************************/
+        Framebuffer(int width, int height);
+
+        int getWidth() const;       // Getter for the width
+
+        int getHeight() const;      // Getter for the height
+
+        // Getter for the RGBA bytes, 4 * width * height of them
+        const std::uint8_t* getData() const;
+
+        // Getter for a pixel, throws if it is outside the image
+        Color getPixel(int x, int y) const;
+
+        // Sets every pixel to the color
+        void clear(const Color& color);
+
+        /**********************************************************************
+         * Draws a line 1 pixel wide from (x0, y0) to (x1, y1), using Xiaolin
+         * Wu's algorithm: at each step along the longer axis, the line
+         * falls between two pixels, and they share its color in proportion
+         * to how close it passes to each.
+        **********************************************************************/
+        void drawLine(real x0, real y0, real x1, real y1, const Color& color);
+
+        /**********************************************************************
+         * Draws the outline of a circle of the given radius and thickness.
+         * The coverage of a pixel follows from the distance between its
+         * center and the circle, and only the rows' spans that the outline
+         * crosses are visited, so the cost grows with the perimeter and not
+         * the area.
+        **********************************************************************/
+        void drawCircle(real x, real y, real radius, real thickness,
+            const Color& color);
+
+        /**********************************************************************
+         * Blends another image of the same size over this one, using the
+         * opacity of each of its pixels. Throws an invalid argument error
+         * if the sizes differ.
+        **********************************************************************/
+        void draw(const Framebuffer& layer);
+    };
+}
+
+#endif
@@ -0,0 +1,37 @@
+/******************************************************************************
+ * GaussKronrod.h
+ * Header file for the GaussKronrod class, which holds the nodes and
+ * weights of the 15 point Gauss-Kronrod rule.
+ * The 15 nodes contain the 7 nodes of the Gauss-Legendre rule of order 7,
+ * so both rules are evaluated from the same samples, and the difference
+ * between the two results estimates the error of the 15 point one. This is
+ * what adaptive integration uses to decide where to refine.
+******************************************************************************/
+
+#ifndef GAUSS_KRONROD_H
+#define GAUSS_KRONROD_H
+
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * GaussKronrod class definition.
+     * The rule is symmetric on [-1, 1], so only the 8 nodes in [0, 1] are
+     * stored, largest first, the last being 0. The nodes at odd indices
+     * are the positive nodes of the 7 point Gauss rule.
+    **************************************************************************/
+    class GaussKronrod{
+    public:
+
+        static constexpr int NODE_COUNT = 8;    // Stored nodes, 0 included
+
+        static const real NODES[NODE_COUNT];            // Kronrod nodes
+
+        static const real KRONROD_WEIGHTS[NODE_COUNT];  // 15 point weights
+
+        // 7 point Gauss weights of the nodes at indices 1, 3, 5 and 7
+        static const real GAUSS_WEIGHTS[NODE_COUNT / 2];
+    };
+}
+
+#endif
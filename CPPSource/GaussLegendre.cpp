@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Source file for the GaussLegendre class member functions.
+******************************************************************************/
+
+#include "GaussLegendre.h"
+
+using namespace fs;
+
+
+// Compute table function definition
+GaussLegendre::Table GaussLegendre::computeTable(){
+    Table table;
+    table.nodes.resize(MAX_ORDER + 1);
+    table.weights.resize(MAX_ORDER + 1);
+
+    for(int k = 1; k <= MAX_ORDER; k++){
+        table.nodes[k].resize(k);
+        table.weights[k].resize(k);
+
+        // The roots are symmetric, so only half of them are searched for
+        for(int i = 0; i < (k + 1) / 2; i++){
+            // Close initial guess for the ith largest root
+            real x = std::cos(PI * (i + 0.75) / (k + 0.5));
+            real derivative = 0;
+
+            for(int iteration = 0; iteration < 100; iteration++){
+                /**************************************************************
+                 * Evaluates P_k(x) with the recurrence
+                 * j * P_j = (2j - 1) * x * P_(j-1) - (j - 1) * P_(j-2),
+                 * and its derivative from P_k and P_(k-1).
+                **************************************************************/
+                real current = 1, previous = 0;
+                for(int j = 1; j <= k; j++){
+                    real next = ((2 * j - 1) * x * current 
+                        - (j - 1) * previous) / j;
+                    previous = current;
+                    current = next;
+                }
+                derivative = k * (x * current - previous) / (x * x - 1);
+
+                real step = current / derivative;
+                x -= step;
+                if(std::abs(step) < 1e-16){
+                    break;
+                }
+            }
+
+            real weight = 2 / ((1 - x * x) * derivative * derivative);
+            table.nodes[k][i] = -x;
+            table.nodes[k][k - 1 - i] = x;
+            table.weights[k][i] = weight;
+            table.weights[k][k - 1 - i] = weight;
+        }
+    }
+    return table;
+}
+
+
+// Get table function definition
+const GaussLegendre::Table& GaussLegendre::getTable(){
+    // Initialized once, thread safely
+    static const Table table = computeTable();
+    return table;
+}
+
+
+// Get nodes function definition
+const std::vector<real>& GaussLegendre::getNodes(int order){
+    if(order < 1 || order > MAX_ORDER){
+        throw std::invalid_argument("The order is out of range");
+    }
+    return getTable().nodes[order];
+}
+
+
+// Get weights function definition
+const std::vector<real>& GaussLegendre::getWeights(int order){
+    if(order < 1 || order > MAX_ORDER){
+        throw std::invalid_argument("The order is out of range");
+    }
+    return getTable().weights[order];
+}
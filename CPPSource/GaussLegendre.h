@@ -0,0 +1,57 @@
+/******************************************************************************
+ * GaussLegendre.h
+ * Header file for the GaussLegendre class, which holds the nodes and
+ * weights of the Gauss-Legendre quadrature rules.
+ * A rule of order k approximates the integral of f from -1 to 1 as the sum
+ * of w[i] * f(x[i]) for i = 0 to k - 1, where the nodes x[i] are the roots
+ * of the Legendre polynomial of degree k. It is exact for polynomials of
+ * degree up to 2k - 1, so it needs far fewer samples than a sum of
+ * rectangles for smooth functions such as a polynomial times a sine.
+******************************************************************************/
+
+#ifndef GAUSS_LEGENDRE_H
+#define GAUSS_LEGENDRE_H
+
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * GaussLegendre class definition.
+     * The nodes and weights of every order are computed once, the first
+     * time any of them is needed, and kept for the rest of the program.
+    **************************************************************************/
+    class GaussLegendre{
+    private:
+
+        // Nodes and weights of the rule of each order, indexed by order
+        struct Table{
+            std::vector<std::vector<real>> nodes;
+            std::vector<std::vector<real>> weights;
+        };
+
+        // Computes the table, finding the roots with Newton's method
+        static Table computeTable();
+
+        // Returns the table, computing it on the first call
+        static const Table& getTable();
+
+    public:
+
+        static constexpr int MAX_ORDER = 32;    // Largest supported order
+
+        /**********************************************************************
+         * Returns the k nodes of the rule of order k on [-1, 1], in 
+         * increasing order. The order must be between 1 and MAX_ORDER, or
+         * an invalid argument error is thrown.
+        **********************************************************************/
+        static const std::vector<real>& getNodes(int order);
+
+        // Returns the k weights matching the nodes of getNodes
+        static const std::vector<real>& getWeights(int order);
+    };
+}
+
+#endif
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Source file for the HeadlessRenderer class member functions.
+******************************************************************************/
+
+#include "HeadlessRenderer.h"
+
+using namespace fs;
+
+namespace {
+    // The colors of the SFML window
+    const Color BACKGROUND{0, 0, 0, 255};
+    const Color CIRCLE{255, 255, 255, 40};
+    const Color VECTOR{0, 0, 255, 255};
+    const Color TRACE{255, 0, 0, 255};
+}
+
+
+// Argumented constructor definition
+HeadlessRenderer::HeadlessRenderer(int canvasSize, real minimumRadius)
+    : frame(canvasSize, canvasSize), trace(canvasSize, canvasSize),
+    minimumRadius{minimumRadius}, traced{false} {}
+
+
+// To pixel x function definition
+real HeadlessRenderer::toPixelX(real x) const{
+    return x + frame.getWidth() / 2.0;
+}
+
+
+// To pixel y function definition
+real HeadlessRenderer::toPixelY(real y) const{
+    return y + frame.getHeight() / 2.0;
+}
+
+
+// Render function definition
+const Framebuffer& HeadlessRenderer::render(const AnimationEngine& engine,
+    bool showChain, bool showCircles){
+
+    frame.clear(BACKGROUND);
+
+    if(!showChain){
+        traceTo(engine.getTip());
+        frame.draw(trace);
+        return frame;
+    }
+
+    /**************************************************************************
+     * A circle smaller than minimumRadius isn't drawn, and its vector is
+     * merged into the next one that is, drawn from end to end.
+    **************************************************************************/
+    ComplexNumber tip, drawn;
+    bool hidden = false;    // Whether circles since drawn were skipped
+    for(int i = 0; i < engine.getCircleNumber(); i++){
+        ComplexNumber circle = engine.getCircle(i);
+        ComplexNumber next = tip + circle;
+        if(circle.getMagnitude() >= minimumRadius){
+            if(showCircles){
+                frame.drawCircle(toPixelX(tip.getReal()),
+                    toPixelY(tip.getImaginary()), circle.getMagnitude(), 1,
+                    CIRCLE);
+            }
+            drawVector(drawn, next);
+            drawn = next;
+            hidden = false;
+        }
+        else{
+            hidden = true;
+        }
+        tip = next;
+    }
+    if(hidden){
+        drawVector(drawn, tip);
+    }
+
+    traceTo(tip);
+    frame.draw(trace);
+    return frame;
+}
+
+
+// Draw vector function definition
+void HeadlessRenderer::drawVector(const ComplexNumber& start,
+    const ComplexNumber& end){
+
+    frame.drawLine(toPixelX(start.getReal()), toPixelY(start.getImaginary()),
+        toPixelX(end.getReal()), toPixelY(end.getImaginary()), VECTOR);
+}
+
+
+// Trace to function definition
+void HeadlessRenderer::traceTo(const ComplexNumber& tip){
+    // Only the newest segment of the path is added to its layer
+    if(traced){
+        trace.drawLine(toPixelX(lastTip.getReal()),
+            toPixelY(lastTip.getImaginary()), toPixelX(tip.getReal()),
+            toPixelY(tip.getImaginary()), TRACE);
+    }
+    traced = true;
+    lastTip = tip;
+}
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * HeadlessRenderer.h
+ * Header file for the HeadlessRenderer class, which draws the frames of
+ * the animation into a Framebuffer instead of a window.
+ * It draws what the SFML window in main.cpp draws: the circles, the chain
+ * of vectors from the origin to the tip, and the path the tip has traced
+ * so far. This lets the frames be rendered on a machine with no display
+ * or GPU, and written out as images.
+******************************************************************************/
+
+#ifndef HEADLESS_RENDERER_H
+#define HEADLESS_RENDERER_H
+
+#include "Framebuffer.h"
+#include "AnimationEngine.h"
+#include "ComplexNumber.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * HeadlessRenderer class definition.
+     * The origin is at the center of the canvas, like the SFML view. The
+     * traced path is kept in a layer of its own, to which each frame only
+     * adds its newest segment, and which is then drawn over the frame.
+    **************************************************************************/
+    class HeadlessRenderer{
+    private:
+
+        Framebuffer frame;      // Image of the current frame
+        Framebuffer trace;      // Path traced by the tip so far
+        real minimumRadius;     // Radius below which circles aren't drawn
+
+        bool traced;            // Whether the tip has been traced before
+        ComplexNumber lastTip;  // Tip of the previous frame
+
+        // Converts a point of the animation to pixel coordinates
+        real toPixelX(real x) const;
+        real toPixelY(real y) const;
+
+        // Draws a vector of the chain between two points of the animation
+        void drawVector(const ComplexNumber& start, const ComplexNumber& end);
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, for a square canvas of the given size.
+         * Circles with a radius below minimumRadius pixels are not drawn,
+         * though they still move the tip, 0 drawing all of them.
+        **********************************************************************/
+        HeadlessRenderer(int canvasSize, real minimumRadius);
+
+        /**********************************************************************
+         * Draws the current frame of the animation and returns it.
+         * The traced path is always drawn, and extended by the engine's tip.
+         * showChain draws the vectors, and showCircles their circles too,
+         * which main.cpp only does for the first turn.
+         * The frame is only valid until the next call.
+        **********************************************************************/
+        const Framebuffer& render(const AnimationEngine& engine,
+            bool showChain, bool showCircles);
+
+        /**********************************************************************
+         * Extends the traced path to tip without drawing a frame, which
+         * catches the path up when a renderer starts in the middle of the
+         * animation.
+        **********************************************************************/
+        void traceTo(const ComplexNumber& tip);
+    };
+}
+
+#endif
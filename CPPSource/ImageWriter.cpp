@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Source file for the ImageWriter class member functions.
+******************************************************************************/
+
+#include "ImageWriter.h"
+
+using namespace fs;
+
+namespace {
+    // Appends a 32 bit number with its most significant byte first
+    void appendBigEndian(std::vector<std::uint8_t>& bytes,
+        std::uint32_t value){
+        for(int shift = 24; shift >= 0; shift -= 8){
+            bytes.push_back(static_cast<std::uint8_t>(value >> shift));
+        }
+    }
+}
+
+
+// CRC-32 function definition
+std::uint32_t ImageWriter::crc32(const std::uint8_t* bytes, size_t size,
+    std::uint32_t crc){
+
+    // Table of the CRC of every byte, computed the first time it is needed
+    static const std::vector<std::uint32_t> table = []{
+        std::vector<std::uint32_t> result(256);
+        for(std::uint32_t n = 0; n < 256; n++){
+            std::uint32_t c = n;
+            for(int k = 0; k < 8; k++){
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            result[n] = c;
+        }
+        return result;
+    }();
+
+    crc = ~crc;
+    for(size_t i = 0; i < size; i++){
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+
+// Write chunk function definition
+void ImageWriter::writeChunk(std::ostream& out, const char* type,
+    const std::vector<std::uint8_t>& data){
+
+    std::vector<std::uint8_t> header;
+    appendBigEndian(header, data.size());
+    header.insert(header.end(), type, type + 4);
+
+    // The CRC covers the type and the data, not the length
+    std::uint32_t crc = crc32(header.data() + 4, 4, 0);
+    crc = crc32(data.data(), data.size(), crc);
+
+    std::vector<std::uint8_t> footer;
+    appendBigEndian(footer, crc);
+
+    out.write(reinterpret_cast<const char*>(header.data()), header.size());
+    out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    out.write(reinterpret_cast<const char*>(footer.data()), footer.size());
+}
+
+
+// Write PPM function definition
+void ImageWriter::writePPM(const Framebuffer& image,
+    const std::string& filePath){
+
+    std::ofstream file(filePath, std::ios::binary);
+    if(!file.is_open()){
+        throw std::runtime_error("Cannot open " + filePath);
+    }
+
+    file << "P6\n" << image.getWidth() << " " << image.getHeight()
+        << "\n255\n";
+
+    std::vector<char> row(image.getWidth() * 3);
+    const std::uint8_t* data = image.getData();
+    for(int y = 0; y < image.getHeight(); y++){
+        for(int x = 0; x < image.getWidth(); x++){
+            const std::uint8_t* pixel =
+                data + (static_cast<size_t>(y) * image.getWidth() + x) * 4;
+            row[x * 3] = pixel[0];
+            row[x * 3 + 1] = pixel[1];
+            row[x * 3 + 2] = pixel[2];
+        }
+        file.write(row.data(), row.size());
+    }
+
+    if(!file){
+        throw std::runtime_error("Cannot write " + filePath);
+    }
+}
+
+
+// Write PNG function definition
+void ImageWriter::writePNG(const Framebuffer& image,
+    const std::string& filePath){
+
+    std::ofstream file(filePath, std::ios::binary);
+    if(!file.is_open()){
+        throw std::runtime_error("Cannot open " + filePath);
+    }
+
+    const std::uint8_t signature[8] = {137, 'P', 'N', 'G', '\r', '\n', 26,
+        '\n'};
+    file.write(reinterpret_cast<const char*>(signature), 8);
+
+    // Width, height, 8 bits per channel, RGBA, and the default methods
+    std::vector<std::uint8_t> header;
+    appendBigEndian(header, image.getWidth());
+    appendBigEndian(header, image.getHeight());
+    header.insert(header.end(), {8, 6, 0, 0, 0});
+    writeChunk(file, "IHDR", header);
+
+    /**************************************************************************
+     * Each row starts with its filter type, 0 for none. The rows are then
+     * wrapped in a zlib stream of stored deflate blocks, at most 65535
+     * bytes each, followed by the Adler-32 checksum of the rows.
+    **************************************************************************/
+    size_t rowSize = static_cast<size_t>(image.getWidth()) * 4;
+    std::vector<std::uint8_t> rows;
+    rows.reserve((rowSize + 1) * image.getHeight());
+    for(int y = 0; y < image.getHeight(); y++){
+        rows.push_back(0);
+        const std::uint8_t* row = image.getData() + y * rowSize;
+        rows.insert(rows.end(), row, row + rowSize);
+    }
+
+    std::vector<std::uint8_t> stream{0x78, 0x01};
+    const size_t blockSize = 65535;
+    for(size_t start = 0; ; start += blockSize){
+        size_t size = std::min(blockSize, rows.size() - start);
+        bool last = start + size >= rows.size();
+        stream.push_back(last ? 1 : 0);
+        stream.push_back(size & 0xFF);
+        stream.push_back(size >> 8);
+        stream.push_back(~size & 0xFF);
+        stream.push_back((~size >> 8) & 0xFF);
+        stream.insert(stream.end(), rows.begin() + start,
+            rows.begin() + start + size);
+        if(last){
+            break;
+        }
+    }
+
+    std::uint32_t a = 1, b = 0;
+    for(std::uint8_t byte : rows){
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    appendBigEndian(stream, (b << 16) | a);
+
+    writeChunk(file, "IDAT", stream);
+    writeChunk(file, "IEND", {});
+
+    if(!file){
+        throw std::runtime_error("Cannot write " + filePath);
+    }
+}
+
+
+// Write raw function definition
+void ImageWriter::writeRaw(const Framebuffer& image, std::ostream& out){
+    out.write(reinterpret_cast<const char*>(image.getData()),
+        static_cast<std::streamsize>(image.getWidth()) * image.getHeight()
+        * 4);
+}
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * ImageWriter.h
+ * Header file for the ImageWriter class, which writes a Framebuffer out as
+ * an image file, or as raw bytes for another program to read.
+ * PPM is the simplest format there is, a short text header followed by
+ * the RGB bytes. PNG keeps the opacity, and is written without any
+ * library: the image data is stored in uncompressed deflate blocks, which
+ * every PNG reader accepts, at the cost of larger files.
+******************************************************************************/
+
+#ifndef IMAGE_WRITER_H
+#define IMAGE_WRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include "Framebuffer.h"
+
+namespace fs {
+    /**************************************************************************
+     * ImageWriter class definition.
+     * Like SimdKernels, this is a helper class with no member variables.
+     * The file functions throw a runtime error if the file can't be
+     * written.
+    **************************************************************************/
+    class ImageWriter{
+    private:
+
+        // CRC-32 of bytes, continuing from crc, as PNG chunks need
+        static std::uint32_t crc32(const std::uint8_t* bytes, size_t size,
+            std::uint32_t crc);
+
+        // Adds a PNG chunk of the given type and data to the output
+        static void writeChunk(std::ostream& out, const char* type,
+            const std::vector<std::uint8_t>& data);
+
+    public:
+
+        // Writes the image as a binary PPM file, dropping the opacity
+        static void writePPM(const Framebuffer& image,
+            const std::string& filePath);
+
+        // Writes the image as an RGBA PNG file
+        static void writePNG(const Framebuffer& image,
+            const std::string& filePath);
+
+        /**********************************************************************
+         * Writes the RGBA bytes of the image to out, row by row, with no
+         * header, which is what video encoders read from a pipe.
+        **********************************************************************/
+        static void writeRaw(const Framebuffer& image, std::ostream& out);
+    };
+}
+
+#endif
@@ -0,0 +1,41 @@
+/******************************************************************************
+ * IntegrationMethod.h
+ * Header file for the IntegrationMethod enum, which selects how the
+ * Fourier coefficients of a curve are integrated.
+******************************************************************************/
+
+#ifndef INTEGRATION_METHOD_H
+#define INTEGRATION_METHOD_H
+
+namespace fs {
+    /**************************************************************************
+     * Integration methods used when generating the Fourier coefficients.
+     * RIEMANN_SUM divides the area under the curve into rectangles of
+     * width dt, so its accuracy depends on how small dt is.
+     * EXACT uses the closed form of the integral of a polynomial times
+     * e^(2 * pi * i * n * t), which exists since x(t) and y(t) are
+     * polynomials. It does not use dt at all.
+     * FFT samples the whole curve once on a uniform grid of step at most dt
+     * and gets every coefficient from a single Fourier transform. This is
+     * the same sum of rectangles as RIEMANN_SUM, computed for all the
+     * circles at once, so a single integral falls back to RIEMANN_SUM.
+     * GAUSS_LEGENDRE splits each curve into sub-intervals no wider than dt
+     * and applies a Gauss-Legendre rule to each, which is much more
+     * accurate than RIEMANN_SUM for the same number of samples. The number
+     * of nodes per sub-interval is given by an IntegrationPolicy.
+     * ADAPTIVE applies the 15 point Gauss-Kronrod rule and keeps halving
+     * the sub-intervals whose error estimate is too large, until the
+     * total estimate is within the absolute tolerance of an
+     * IntegrationPolicy. Only the oscillating parts, which means high
+     * frequencies, get refined. It does not use dt.
+    **************************************************************************/
+    enum class IntegrationMethod {
+        RIEMANN_SUM,
+        EXACT,
+        FFT,
+        GAUSS_LEGENDRE,
+        ADAPTIVE
+    };
+}
+
+#endif
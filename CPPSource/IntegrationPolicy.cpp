@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Source file for the IntegrationPolicy class member functions.
+******************************************************************************/
+
+#include "IntegrationPolicy.h"
+#include "GaussLegendre.h"
+
+using namespace fs;
+
+// Argumented constructor definition
+IntegrationPolicy::IntegrationPolicy(IntegrationMethod method, real dt)
+    : method{method}, dt{dt}, order{DEFAULT_ORDER},
+    tolerance{DEFAULT_TOLERANCE} {}
+
+
+// Argumented constructor with order definition
+IntegrationPolicy::IntegrationPolicy(IntegrationMethod method, real dt,
+    int order) : method{method}, dt{dt}, order{order},
+    tolerance{DEFAULT_TOLERANCE} {
+
+    if(order < 1 || order > GaussLegendre::MAX_ORDER){
+        throw std::invalid_argument("The order is out of range");
+    }
+}
+
+
+// Argumented constructor with order and tolerance definition
+IntegrationPolicy::IntegrationPolicy(IntegrationMethod method, real dt,
+    int order, real tolerance) : IntegrationPolicy(method, dt, order) {
+
+    if(tolerance <= 0){
+        throw std::invalid_argument("The tolerance must be positive");
+    }
+    this->tolerance = tolerance;
+}
+
+
+// Method getter definition
+IntegrationMethod IntegrationPolicy::getMethod() const{
+    return method;
+}
+
+
+// dt getter definition
+real IntegrationPolicy::getDt() const{
+    return dt;
+}
+
+
+// Order getter definition
+int IntegrationPolicy::getOrder() const{
+    return order;
+}
+
+
+// Tolerance getter definition
+real IntegrationPolicy::getTolerance() const{
+    return tolerance;
+}
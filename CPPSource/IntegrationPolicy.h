@@ -0,0 +1,79 @@
+/******************************************************************************
+ * IntegrationPolicy.h
+ * Header file for the IntegrationPolicy class, which bundles the
+ * integration method used to generate the Fourier coefficients with the
+ * parameters that method needs.
+******************************************************************************/
+
+#ifndef INTEGRATION_POLICY_H
+#define INTEGRATION_POLICY_H
+
+#include "IntegrationMethod.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * IntegrationPolicy class definition.
+     * dt is the width of the rectangles for RIEMANN_SUM, the largest
+     * sampling step for FFT, and the largest width of the sub-intervals
+     * each curve is split into for GAUSS_LEGENDRE, where AUTOMATIC_DT
+     * instead picks the sub-intervals from the frequency of each circle.
+     * order is the number of Gauss-Legendre nodes per sub-interval, and is
+     * only used by that method. tolerance is the absolute error targeted by
+     * ADAPTIVE, and is only used by that method.
+    **************************************************************************/
+    class IntegrationPolicy{
+    private:
+
+        IntegrationMethod method;   // Integration method
+        real dt;                    // Step or sub-interval width
+        int order;                  // Gauss-Legendre nodes per sub-interval
+        real tolerance;             // Targeted absolute error
+
+    public:
+
+        // Order used when none is given
+        static constexpr int DEFAULT_ORDER = 8;
+
+        // Tolerance used when none is given
+        static constexpr real DEFAULT_TOLERANCE = 1e-6;
+
+        /**********************************************************************
+         * dt that lets GAUSS_LEGENDRE split each curve into as few
+         * sub-intervals as the frequency allows, rather than into ones of a
+         * fixed width, which the low frequencies don't need.
+        **********************************************************************/
+        static constexpr real AUTOMATIC_DT = 0;
+
+        /**********************************************************************
+         * Argumented constructor, with the default Gauss-Legendre order
+         * and tolerance.
+        **********************************************************************/
+        IntegrationPolicy(IntegrationMethod method, real dt);
+
+        /**********************************************************************
+         * Argumented constructor.
+         * The order must be between 1 and GaussLegendre::MAX_ORDER, or an
+         * invalid argument error is thrown.
+        **********************************************************************/
+        IntegrationPolicy(IntegrationMethod method, real dt, int order);
+
+        /**********************************************************************
+         * Argumented constructor.
+         * On top of the checks of the constructor above, the tolerance
+         * must be positive, or an invalid argument error is thrown.
+        **********************************************************************/
+        IntegrationPolicy(IntegrationMethod method, real dt, int order,
+            real tolerance);
+
+        IntegrationMethod getMethod() const;    // Getter for the method
+
+        real getDt() const;                     // Getter for dt
+
+        int getOrder() const;                   // Getter for the order
+
+        real getTolerance() const;              // Getter for the tolerance
+    };
+}
+
+#endif
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Source file for the MappedFile class member functions.
+******************************************************************************/
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace fs;
+
+
+// Argumented constructor definition
+MappedFile::MappedFile(const std::string& filePath) : data{nullptr},
+    size{0} {
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ,
+        FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if(file == INVALID_HANDLE_VALUE){
+        throw std::runtime_error("Could not open " + filePath);
+    }
+
+    LARGE_INTEGER fileSize;
+    if(!GetFileSizeEx(file, &fileSize)){
+        CloseHandle(file);
+        throw std::runtime_error("Could not read the size of " + filePath);
+    }
+    size = static_cast<size_t>(fileSize.QuadPart);
+
+    // An empty file can't be mapped, and is left as an empty view
+    if(size > 0){
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY,
+            0, 0, nullptr);
+        if(mapping != nullptr){
+            data = static_cast<const char*>(
+                MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            // The view keeps the mapping alive on its own
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int file = open(filePath.c_str(), O_RDONLY);
+    if(file < 0){
+        throw std::runtime_error("Could not open " + filePath);
+    }
+
+    struct stat status;
+    if(fstat(file, &status) != 0){
+        close(file);
+        throw std::runtime_error("Could not read the size of " + filePath);
+    }
+    size = static_cast<size_t>(status.st_size);
+
+    // An empty file can't be mapped, and is left as an empty view
+    if(size > 0){
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if(mapping != MAP_FAILED){
+            data = static_cast<const char*>(mapping);
+        }
+    }
+    // The mapping keeps the file alive on its own
+    close(file);
+#endif
+
+    if(size > 0 && data == nullptr){
+        throw std::runtime_error("Could not map " + filePath);
+    }
+}
+
+
+// Move constructor definition
+MappedFile::MappedFile(MappedFile&& other) noexcept : data{other.data},
+    size{other.size} {
+
+    other.data = nullptr;
+    other.size = 0;
+}
+
+
+// Move assignment operator definition
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept{
+    if(this != &other){
+        unmap();
+        data = other.data;
+        size = other.size;
+        other.data = nullptr;
+        other.size = 0;
+    }
+    return *this;
+}
+
+
+// Destructor definition
+MappedFile::~MappedFile(){
+    unmap();
+}
+
+
+// Unmap function definition
+void MappedFile::unmap(){
+    if(data != nullptr){
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<char*>(data), size);
+#endif
+        data = nullptr;
+    }
+}
+
+
+// Get view function definition
+std::string_view MappedFile::getView() const{
+    return std::string_view(data, data == nullptr ? 0 : size);
+}
+
+
+// Get size function definition
+size_t MappedFile::getSize() const{
+    return size;
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+ * MappedFile.h
+ * Header file for the MappedFile class, which maps a file into memory
+ * instead of reading it.
+ * Reading a file into a string copies all of it, and taking parts of that
+ * string copies them again. A mapped file is read straight from the pages
+ * the operating system loads on demand, and its parts can be handed out
+ * as string views, without any copy, as long as the mapping is alive.
+ * It uses mmap on POSIX systems and CreateFileMapping on Windows.
+******************************************************************************/
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <cstddef>
+
+namespace fs {
+    /**************************************************************************
+     * MappedFile class definition.
+     * The file is mapped read only when the object is created, and unmapped
+     * when it is destroyed, so views of it must not outlive it. It can be
+     * moved but not copied, as a mapping has a single owner.
+    **************************************************************************/
+    class MappedFile{
+    private:
+
+        const char* data;   // Start of the mapping, null for an empty file
+        size_t size;        // Size of the file in bytes
+
+        // Unmaps the file, if mapped
+        void unmap();
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, maps the file at the given path.
+         * Throws a runtime error if it can't be opened or mapped.
+        **********************************************************************/
+        MappedFile(const std::string& filePath);
+
+        // Move constructor and assignment, leaving the other object empty
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Destructor
+        ~MappedFile();
+
+        // Returns the whole file, valid for as long as the object lives
+        std::string_view getView() const;
+
+        // Returns the size of the file in bytes
+        size_t getSize() const;
+    };
+}
+
+#endif
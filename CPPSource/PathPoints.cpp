@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Source file for the PathPoints class member functions.
+******************************************************************************/
+
+#include "PathPoints.h"
+
+using namespace fs;
+
+
+// No arg constructor definition
+PathPoints::PathPoints() : offsets{0} {}
+
+
+// Add point function definition
+void PathPoints::addPoint(const Point& point){
+    points.push_back(point);
+}
+
+
+// End curve function definition
+void PathPoints::endCurve(){
+    if(points.size() == offsets.back()){
+        throw std::invalid_argument("A curve must have at least one point");
+    }
+    offsets.push_back(points.size());
+}
+
+
+// Discard curve function definition
+void PathPoints::discardCurve(){
+    points.resize(offsets.back());
+}
+
+
+// Get curve number function definition
+int PathPoints::getCurveNumber() const{
+    return offsets.size() - 1;
+}
+
+
+// Get point number function definition
+int PathPoints::getPointNumber(int curve) const{
+    if(curve < 0 || curve >= getCurveNumber()){
+        throw std::out_of_range("The curve does not exist");
+    }
+    return offsets[curve + 1] - offsets[curve];
+}
+
+
+// Get curve function definition
+const Point* PathPoints::getCurve(int curve) const{
+    if(curve < 0 || curve >= getCurveNumber()){
+        throw std::out_of_range("The curve does not exist");
+    }
+    return points.data() + offsets[curve];
+}
+
+
+// Get points function definition
+std::vector<Point>& PathPoints::getPoints(){
+    return points;
+}
+
+
+// Get points function definition
+const std::vector<Point>& PathPoints::getPoints() const{
+    return points;
+}
+
+
+// To vectors function definition
+std::vector<std::vector<Point>> PathPoints::toVectors() const{
+    std::vector<std::vector<Point>> curves(getCurveNumber());
+    for(int i = 0; i < getCurveNumber(); i++){
+        curves[i].assign(points.begin() + offsets[i],
+            points.begin() + offsets[i + 1]);
+    }
+    return curves;
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * PathPoints.h
+ * Header file for the PathPoints class, which holds the control points of
+ * the consecutive Bezier curves of a path.
+ * A vector of points per curve allocates once for every curve, and spreads
+ * the points all over memory. Here the points of all the curves are kept
+ * one after the other in a single array, with the position at which each
+ * curve starts, which is the layout BezierCurveVector stores them in.
+******************************************************************************/
+
+#ifndef PATH_POINTS_H
+#define PATH_POINTS_H
+
+#include <vector>
+#include <stdexcept>
+#include "Point.h"
+
+namespace fs {
+    /**************************************************************************
+     * PathPoints class definition.
+     * Like the vectors returned by FourierSeries::parseSVGPath, each curve
+     * starts with the last point of the previous one. Points are added to
+     * the curve being built, which only counts as a curve once ended.
+    **************************************************************************/
+    class PathPoints{
+    private:
+
+        std::vector<Point> points;  // Points of every curve, in order
+        std::vector<int> offsets;   // Position of the first point of each
+
+    public:
+
+        // No arg constructor, creates an empty path
+        PathPoints();
+
+        // Adds a point to the curve being built
+        void addPoint(const Point& point);
+
+        // Ends the curve being built, which must have at least one point
+        void endCurve();
+
+        // Removes the points of the curve being built
+        void discardCurve();
+
+        // Returns the number of ended curves
+        int getCurveNumber() const;
+
+        /**********************************************************************
+         * Returns the number of points in a curve, and a pointer to the
+         * first of them. Throws out of range if the curve doesn't exist.
+        **********************************************************************/
+        int getPointNumber(int curve) const;
+        const Point* getCurve(int curve) const;
+
+        /**********************************************************************
+         * Returns all of the points, of every curve, in order, which can be
+         * changed in place to move or scale the path.
+        **********************************************************************/
+        std::vector<Point>& getPoints();
+        const std::vector<Point>& getPoints() const;
+
+        // Returns a vector of points per curve, as parseSVGPath does
+        std::vector<std::vector<Point>> toVectors() const;
+    };
+}
+
+#endif
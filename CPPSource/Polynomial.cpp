@@ -6,6 +6,68 @@
 
 using namespace fs;
 
+// PolynomialView constructor definition
+PolynomialView::PolynomialView(const real* coefficients, int degree) 
+    : coefficients{coefficients}, degree{degree} {}
+
+
+// PolynomialView coefficient getter definition
+real PolynomialView::getCoefficient(int index) const{
+    if(index < 0 || index > degree){
+        throw std::invalid_argument("The index does not exist");
+    }
+    return coefficients[index];
+}
+
+
+// PolynomialView coefficients getter definition
+const real* PolynomialView::getCoefficients() const{
+    return coefficients;
+}
+
+
+// PolynomialView degree getter definition
+int PolynomialView::getDegree() const{
+    return degree;
+}
+
+
+// PolynomialView getAbsoluteValue definition
+real PolynomialView::getAbsoluteValue(real t) const{
+    real result{};
+    for(int i = degree; i >= 0; i--){
+        result = std::abs(coefficients[i]) + std::abs(t) * result;
+    }
+    return result;
+}
+
+
+// PolynomialView getDerivativeValue definition
+real PolynomialView::getDerivativeValue(real t, int k) const{
+    real result{};
+    // Horner's rule over the terms that survive k derivatives
+    for(int i = degree; i >= k; i--){
+        real factor = 1;
+        for(int j = i - k + 1; j <= i; j++){
+            factor *= j;
+        }
+        result = factor * coefficients[i] + t * result;
+    }
+    return result;
+}
+
+
+// PolynomialView getAntiderivativeValue definition
+real PolynomialView::getAntiderivativeValue(real t) const{
+    real result{};
+    for(int i = degree; i >= 0; i--){
+        result = coefficients[i] / (i + 1) + t * result;
+    }
+    // Every term gains a power of t, and the constant is 0
+    return t * result;
+}
+
+
 // getValue function definition
 real Polynomial::getValue(real t) const{
     real result{};  // Resultant value
@@ -23,7 +85,7 @@ real Polynomial::getValue(real t) const{
 
 
 // No arg constructor definition
-Polynomial::Polynomial() : degree{1}{
+Polynomial::Polynomial() : degree{0}{
     /**************************************************************************
      * Every polynomial has at least a constant zero term, so the vector has 
      * size 1 by default. 
@@ -55,6 +117,12 @@ int Polynomial::getDegree() const{
 }
 
 
+// Getter for the view definition
+PolynomialView Polynomial::getView() const{
+    return PolynomialView(coefficients.data(), degree);
+}
+
+
 // Setter for the coefficients definition
 void Polynomial::setCoefficients(std::vector<real>& coefficients){
     // Checks for zero factors multiplying the highest degree terms
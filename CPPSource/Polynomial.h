@@ -16,6 +16,71 @@
 
 namespace fs{
 
+    /**************************************************************************
+     * PolynomialView class definition.
+     * A non-owning view of the coefficients of a polynomial, used where
+     * a polynomial is evaluated many times, so that no copy of its
+     * coefficient vector is made. The view is only valid as long as the
+     * coefficients it points to are neither modified nor destroyed.
+    **************************************************************************/
+    class PolynomialView{
+    private:
+
+        // Coefficients of the polynomial, the ith being that of t^i
+        const real* coefficients;
+
+        // Degree of the polynomial, the number of coefficients - 1
+        int degree;
+
+    public:
+
+        // Argumented constructor, takes the coefficients and the degree
+        PolynomialView(const real* coefficients, int degree);
+
+        real getCoefficient(int index) const;   // Getter for a coefficient
+
+        /**********************************************************************
+         * Getter for the coefficients as a whole, degree + 1 of them.
+         * Unlike getCoefficient, no bounds are checked, which is meant for
+         * the batched kernels that read all of them.
+        **********************************************************************/
+        const real* getCoefficients() const;
+
+        int getDegree() const;                  // Getter for the degree
+
+        /**********************************************************************
+         * Returns the value of the polynomial at t using Horner's rule,
+         * just like Polynomial::getValue.
+        **********************************************************************/
+        real getValue(real t) const{
+            real result{};
+            for(int i = degree; i >= 0; i--){
+                result = coefficients[i] + t * result;
+            }
+            return result;
+        }
+
+        /**********************************************************************
+         * Returns the sum of |c[i]| * |t|^i, which is what the rounding
+         * error of getValue is proportional to. It is much larger than the
+         * value itself when the terms cancel each other out.
+        **********************************************************************/
+        real getAbsoluteValue(real t) const;
+
+        /**********************************************************************
+         * Returns the value of the kth derivative of the polynomial at t,
+         * without building the derivative. The term c * t^i contributes
+         * i! / (i - k)! * c * t^(i - k), and terms with i < k vanish.
+        **********************************************************************/
+        real getDerivativeValue(real t, int k) const;
+
+        /**********************************************************************
+         * Returns the value at t of the antiderivative of the polynomial
+         * whose constant of integration is 0.
+        **********************************************************************/
+        real getAntiderivativeValue(real t) const;
+    };
+
     /**************************************************************************
      * Polynomial class definition, described in terms of its
      * coefficients.
@@ -57,6 +122,12 @@ namespace fs{
         // Getter for the degree
         int getDegree() const;
 
+        /**********************************************************************
+         * Returns a non-owning view of the coefficients, which stays valid
+         * until the polynomial is modified or destroyed.
+        **********************************************************************/
+        PolynomialView getView() const;
+
         /**********************************************************************
          * Setter for all the coefficients.
          * Note that the degree of the polynomial might not exactly match
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * ReorderQueue.h
+ * Header file for the ReorderQueue class template, which hands items that
+ * are produced out of order by several threads to a consumer in order.
+ * Each item has an index, and the consumer pops index 0, then 1, and so
+ * on, waiting for an item if it hasn't been pushed yet. The queue is
+ * bounded: a producer pushing an item too far ahead of the consumer waits
+ * until the consumer catches up, so at most capacity items are held at
+ * once, however far ahead the producers get.
+ * Being a template, the whole class is defined in this header.
+******************************************************************************/
+
+#ifndef REORDER_QUEUE_H
+#define REORDER_QUEUE_H
+
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <utility>
+
+namespace fs {
+    /**************************************************************************
+     * ReorderQueue class template definition.
+     * The producers must claim their indices in increasing order, so that
+     * the item the consumer waits for is always held by a producer that
+     * isn't waiting itself. Otherwise the queue can deadlock.
+    **************************************************************************/
+    template<class T>
+    class ReorderQueue{
+    private:
+
+        std::mutex mutex;
+        std::condition_variable itemPushed;
+        std::condition_variable itemPopped;
+
+        std::map<long long, T> items;   // Items pushed but not yet popped
+        long long next;                 // Index the consumer pops next
+        long long capacity;             // Items allowed ahead of next
+        bool closed;                    // Whether the queue was closed
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the number of items that can be
+         * held at once, which must be positive.
+        **********************************************************************/
+        ReorderQueue(long long capacity) : next{0}, capacity{capacity},
+            closed{false} {
+            if(capacity <= 0){
+                throw std::invalid_argument("The capacity must be positive");
+            }
+        }
+
+        /**********************************************************************
+         * Adds the item with the given index, waiting while it is capacity
+         * or more items ahead of the consumer. Returns false without adding
+         * it if the queue is closed.
+        **********************************************************************/
+        bool push(long long index, T item){
+            std::unique_lock<std::mutex> lock(mutex);
+            itemPopped.wait(lock, [this, index]{
+                return closed || index < next + capacity;
+            });
+            if(closed){
+                return false;
+            }
+            items.emplace(index, std::move(item));
+            itemPushed.notify_all();
+            return true;
+        }
+
+        /**********************************************************************
+         * Waits for the next item in order, and moves it to item. Returns
+         * false if the queue was closed before it arrived.
+        **********************************************************************/
+        bool pop(T& item){
+            std::unique_lock<std::mutex> lock(mutex);
+            itemPushed.wait(lock, [this]{
+                return closed || items.count(next) > 0;
+            });
+            auto found = items.find(next);
+            if(found == items.end()){
+                return false;
+            }
+            item = std::move(found->second);
+            items.erase(found);
+            next++;
+            itemPopped.notify_all();
+            return true;
+        }
+
+        /**********************************************************************
+         * Closes the queue, waking every thread waiting on it, for when a
+         * producer or the consumer fails and the others must stop.
+        **********************************************************************/
+        void close(){
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+            itemPushed.notify_all();
+            itemPopped.notify_all();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Source file for the SVGPathTokenizer class member functions.
+******************************************************************************/
+
+#include "SVGPathTokenizer.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+SVGPathTokenizer::SVGPathTokenizer(std::string_view data)
+    : current{data.data()}, end{data.data() + data.size()} {}
+
+
+// Skip separators function definition
+void SVGPathTokenizer::skipSeparators(){
+    while(current < end && (*current == ','
+        || std::isspace(static_cast<unsigned char>(*current)))){
+        current++;
+    }
+}
+
+
+// Next command function definition
+bool SVGPathTokenizer::nextCommand(char& command){
+    skipSeparators();
+    if(current < end && std::isalpha(static_cast<unsigned char>(*current))){
+        command = *current++;
+        return true;
+    }
+    return false;
+}
+
+
+// Next number function definition
+bool SVGPathTokenizer::nextNumber(real& value){
+    skipSeparators();
+    // from_chars takes a minus sign but not a plus
+    const char* start = current;
+    if(start < end && *start == '+'){
+        start++;
+    }
+    // Nor do svg numbers include inf or nan, which from_chars would take
+    if(start == end || std::isalpha(static_cast<unsigned char>(*start))){
+        return false;
+    }
+
+    std::from_chars_result result = std::from_chars(start, end, value);
+    if(result.ec != std::errc()){
+        return false;
+    }
+    current = result.ptr;
+    return true;
+}
+
+
+// Next flag function definition
+bool SVGPathTokenizer::nextFlag(bool& value){
+    skipSeparators();
+    if(current < end && (*current == '0' || *current == '1')){
+        value = *current++ == '1';
+        return true;
+    }
+    return false;
+}
+
+
+// Skip token function definition
+void SVGPathTokenizer::skipToken(){
+    real value;
+    if(!nextNumber(value) && current < end){
+        current++;
+    }
+}
+
+
+// Is at end function definition
+bool SVGPathTokenizer::isAtEnd(){
+    skipSeparators();
+    return current == end;
+}
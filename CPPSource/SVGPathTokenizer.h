@@ -0,0 +1,70 @@
+/******************************************************************************
+ * SVGPathTokenizer.h
+ * Header file for the SVGPathTokenizer class, which splits the d attribute
+ * of an svg path into its commands and numbers.
+ * Reading the path with an istringstream is slow, depends on the locale,
+ * and reads the compact forms svg allows wrong: in 10-5 the minus starts a
+ * new number, and in .5.5 so does the second dot, without any space. The
+ * tokenizer reads the characters in a single pass, parsing the numbers
+ * with std::from_chars, which neither allocates nor uses the locale.
+******************************************************************************/
+
+#ifndef SVG_PATH_TOKENIZER_H
+#define SVG_PATH_TOKENIZER_H
+
+#include <cctype>
+#include <charconv>
+#include <string_view>
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * SVGPathTokenizer class definition.
+     * Commas and whitespace between tokens are skipped. A command is a
+     * single letter, and a number is anything std::from_chars accepts,
+     * after an optional plus sign. The tokenizer only reads the characters,
+     * which must outlive it.
+    **************************************************************************/
+    class SVGPathTokenizer{
+    private:
+
+        const char* current;    // Next character to read
+        const char* end;        // End of the characters
+
+        // Skips the whitespace and commas before the next token
+        void skipSeparators();
+
+    public:
+
+        // Argumented constructor, takes the characters to read
+        SVGPathTokenizer(std::string_view data);
+
+        /**********************************************************************
+         * Reads the next token if it is a command, returning true and the
+         * letter in command. Returns false, reading nothing, otherwise.
+        **********************************************************************/
+        bool nextCommand(char& command);
+
+        /**********************************************************************
+         * Reads the next token if it is a number, returning true and the
+         * number in value. Returns false, reading nothing, otherwise.
+        **********************************************************************/
+        bool nextNumber(real& value);
+
+        /**********************************************************************
+         * Reads the next token if it is a flag of an arc, 0 or 1, returning
+         * true and the flag in value. Returns false, reading nothing,
+         * otherwise. Flags are a single digit, so two of them and a number
+         * can follow each other without a separator, as in 10-5.
+        **********************************************************************/
+        bool nextFlag(bool& value);
+
+        // Skips the next token, whether it is a command, a number or neither
+        void skipToken();
+
+        // Returns whether there are any tokens left
+        bool isAtEnd();
+    };
+}
+
+#endif
@@ -0,0 +1,365 @@
+/******************************************************************************
+ * Source file for the SimdKernels class member functions.
+ * The AVX2 and SSE2 versions are compiled for their instruction set
+ * through the target attribute, so no compiler flag is needed, and are
+ * only called once the CPU is known to support them.
+******************************************************************************/
+
+#include "SimdKernels.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+using namespace fs;
+
+// Number of steps after which the phasors are put back on the unit circle
+static const int RENORMALIZATION_PERIOD = 64;
+
+
+// Scalar evaluate function definition
+void SimdKernels::evaluateScalar(const PolynomialView& polynomial,
+    const real* times, real* values, int count){
+
+    for(int j = 0; j < count; j++){
+        values[j] = polynomial.getValue(times[j]);
+    }
+}
+
+
+// Scalar integrate function definition
+ComplexNumber SimdKernels::integrateScalar(const PolynomialView& x,
+    const PolynomialView& y, real t0, real dt, int samples, int n){
+
+    real r{0}, i{0};
+    for(int s = 0; s < samples; s++){
+        real t = t0 + s * dt;
+        real xValue = x.getValue(t);
+        real yValue = y.getValue(t);
+        real cosine = cos(2 * PI * t * n);
+        real sine = sin(2 * PI * t * n);
+
+        r += xValue * cosine - yValue * sine;
+        i += xValue * sine + yValue * cosine;
+    }
+    return ComplexNumber(r * dt, i * dt);
+}
+
+
+#ifdef FS_SIMD_X86
+
+/******************************************************************************
+ * AVX2 versions, 4 doubles per register.
+******************************************************************************/
+
+// Horner's rule on 4 values of t at once
+__attribute__((target("avx2")))
+static inline __m256d hornerAvx2(const real* coefficients, int degree,
+    __m256d t){
+
+    __m256d result = _mm256_setzero_pd();
+    for(int i = degree; i >= 0; i--){
+        result = _mm256_add_pd(_mm256_set1_pd(coefficients[i]),
+            _mm256_mul_pd(t, result));
+    }
+    return result;
+}
+
+
+__attribute__((target("avx2")))
+static void evaluateAvx2(const PolynomialView& polynomial,
+    const real* times, real* values, int count){
+
+    const real* coefficients = polynomial.getCoefficients();
+    int degree = polynomial.getDegree();
+
+    int j = 0;
+    for(; j + 4 <= count; j += 4){
+        __m256d t = _mm256_loadu_pd(times + j);
+        _mm256_storeu_pd(values + j, hornerAvx2(coefficients, degree, t));
+    }
+    // The last few values that don't fill a register
+    for(; j < count; j++){
+        values[j] = polynomial.getValue(times[j]);
+    }
+}
+
+
+__attribute__((target("avx2")))
+static ComplexNumber integrateAvx2(const PolynomialView& x,
+    const PolynomialView& y, real t0, real dt, int samples, int n){
+
+    const int lanes = 4;
+    real w = 2 * PI * n;
+
+    /**************************************************************************
+     * Lane k starts at sample k, and every step moves all lanes forward
+     * by 4 samples, so its phasor is rotated by e^(i * w * 4 * dt).
+    **************************************************************************/
+    alignas(32) real phasorR[lanes], phasorI[lanes];
+    for(int k = 0; k < lanes; k++){
+        phasorR[k] = cos(w * (t0 + k * dt));
+        phasorI[k] = sin(w * (t0 + k * dt));
+    }
+    __m256d pR = _mm256_load_pd(phasorR);
+    __m256d pI = _mm256_load_pd(phasorI);
+    __m256d rotorR = _mm256_set1_pd(cos(w * lanes * dt));
+    __m256d rotorI = _mm256_set1_pd(sin(w * lanes * dt));
+
+    __m256d sumR = _mm256_setzero_pd();
+    __m256d sumI = _mm256_setzero_pd();
+    __m256d index = _mm256_set_pd(3, 2, 1, 0);
+    __m256d start = _mm256_set1_pd(t0);
+    __m256d step = _mm256_set1_pd(dt);
+    __m256d advance = _mm256_set1_pd(lanes);
+
+    const real* xCoefficients = x.getCoefficients();
+    const real* yCoefficients = y.getCoefficients();
+
+    int blocks = samples / lanes;
+    for(int b = 0; b < blocks; b++){
+        __m256d t = _mm256_add_pd(start, _mm256_mul_pd(index, step));
+        __m256d xValue = hornerAvx2(xCoefficients, x.getDegree(), t);
+        __m256d yValue = hornerAvx2(yCoefficients, y.getDegree(), t);
+
+        sumR = _mm256_add_pd(sumR, _mm256_sub_pd(_mm256_mul_pd(xValue, pR),
+            _mm256_mul_pd(yValue, pI)));
+        sumI = _mm256_add_pd(sumI, _mm256_add_pd(_mm256_mul_pd(xValue, pI),
+            _mm256_mul_pd(yValue, pR)));
+
+        __m256d r = _mm256_sub_pd(_mm256_mul_pd(pR, rotorR),
+            _mm256_mul_pd(pI, rotorI));
+        pI = _mm256_add_pd(_mm256_mul_pd(pR, rotorI),
+            _mm256_mul_pd(pI, rotorR));
+        pR = r;
+        index = _mm256_add_pd(index, advance);
+
+        if((b + 1) % RENORMALIZATION_PERIOD == 0){
+            __m256d magnitude = _mm256_sqrt_pd(_mm256_add_pd(
+                _mm256_mul_pd(pR, pR), _mm256_mul_pd(pI, pI)));
+            pR = _mm256_div_pd(pR, magnitude);
+            pI = _mm256_div_pd(pI, magnitude);
+        }
+    }
+
+    alignas(32) real totalR[lanes], totalI[lanes];
+    _mm256_store_pd(totalR, sumR);
+    _mm256_store_pd(totalI, sumI);
+    _mm256_store_pd(phasorR, pR);
+    _mm256_store_pd(phasorI, pI);
+
+    real r = totalR[0] + totalR[1] + totalR[2] + totalR[3];
+    real i = totalI[0] + totalI[1] + totalI[2] + totalI[3];
+
+    // The remaining samples use the phasors the lanes stopped at
+    for(int k = 0; k < samples - blocks * lanes; k++){
+        real t = t0 + (blocks * lanes + k) * dt;
+        real xValue = x.getValue(t);
+        real yValue = y.getValue(t);
+        r += xValue * phasorR[k] - yValue * phasorI[k];
+        i += xValue * phasorI[k] + yValue * phasorR[k];
+    }
+    return ComplexNumber(r * dt, i * dt);
+}
+
+
+/******************************************************************************
+ * SSE2 versions, 2 doubles per register.
+******************************************************************************/
+
+// Horner's rule on 2 values of t at once
+__attribute__((target("sse2")))
+static inline __m128d hornerSse2(const real* coefficients, int degree,
+    __m128d t){
+
+    __m128d result = _mm_setzero_pd();
+    for(int i = degree; i >= 0; i--){
+        result = _mm_add_pd(_mm_set1_pd(coefficients[i]),
+            _mm_mul_pd(t, result));
+    }
+    return result;
+}
+
+
+__attribute__((target("sse2")))
+static void evaluateSse2(const PolynomialView& polynomial,
+    const real* times, real* values, int count){
+
+    const real* coefficients = polynomial.getCoefficients();
+    int degree = polynomial.getDegree();
+
+    int j = 0;
+    for(; j + 2 <= count; j += 2){
+        __m128d t = _mm_loadu_pd(times + j);
+        _mm_storeu_pd(values + j, hornerSse2(coefficients, degree, t));
+    }
+    for(; j < count; j++){
+        values[j] = polynomial.getValue(times[j]);
+    }
+}
+
+
+__attribute__((target("sse2")))
+static ComplexNumber integrateSse2(const PolynomialView& x,
+    const PolynomialView& y, real t0, real dt, int samples, int n){
+
+    const int lanes = 2;
+    real w = 2 * PI * n;
+
+    // Same scheme as the AVX2 version, with 2 lanes
+    alignas(16) real phasorR[lanes], phasorI[lanes];
+    for(int k = 0; k < lanes; k++){
+        phasorR[k] = cos(w * (t0 + k * dt));
+        phasorI[k] = sin(w * (t0 + k * dt));
+    }
+    __m128d pR = _mm_load_pd(phasorR);
+    __m128d pI = _mm_load_pd(phasorI);
+    __m128d rotorR = _mm_set1_pd(cos(w * lanes * dt));
+    __m128d rotorI = _mm_set1_pd(sin(w * lanes * dt));
+
+    __m128d sumR = _mm_setzero_pd();
+    __m128d sumI = _mm_setzero_pd();
+    __m128d index = _mm_set_pd(1, 0);
+    __m128d start = _mm_set1_pd(t0);
+    __m128d step = _mm_set1_pd(dt);
+    __m128d advance = _mm_set1_pd(lanes);
+
+    const real* xCoefficients = x.getCoefficients();
+    const real* yCoefficients = y.getCoefficients();
+
+    int blocks = samples / lanes;
+    for(int b = 0; b < blocks; b++){
+        __m128d t = _mm_add_pd(start, _mm_mul_pd(index, step));
+        __m128d xValue = hornerSse2(xCoefficients, x.getDegree(), t);
+        __m128d yValue = hornerSse2(yCoefficients, y.getDegree(), t);
+
+        sumR = _mm_add_pd(sumR, _mm_sub_pd(_mm_mul_pd(xValue, pR),
+            _mm_mul_pd(yValue, pI)));
+        sumI = _mm_add_pd(sumI, _mm_add_pd(_mm_mul_pd(xValue, pI),
+            _mm_mul_pd(yValue, pR)));
+
+        __m128d r = _mm_sub_pd(_mm_mul_pd(pR, rotorR),
+            _mm_mul_pd(pI, rotorI));
+        pI = _mm_add_pd(_mm_mul_pd(pR, rotorI), _mm_mul_pd(pI, rotorR));
+        pR = r;
+        index = _mm_add_pd(index, advance);
+
+        if((b + 1) % RENORMALIZATION_PERIOD == 0){
+            __m128d magnitude = _mm_sqrt_pd(_mm_add_pd(
+                _mm_mul_pd(pR, pR), _mm_mul_pd(pI, pI)));
+            pR = _mm_div_pd(pR, magnitude);
+            pI = _mm_div_pd(pI, magnitude);
+        }
+    }
+
+    alignas(16) real totalR[lanes], totalI[lanes];
+    _mm_store_pd(totalR, sumR);
+    _mm_store_pd(totalI, sumI);
+    _mm_store_pd(phasorR, pR);
+    _mm_store_pd(phasorI, pI);
+
+    real r = totalR[0] + totalR[1];
+    real i = totalI[0] + totalI[1];
+
+    for(int k = 0; k < samples - blocks * lanes; k++){
+        real t = t0 + (blocks * lanes + k) * dt;
+        real xValue = x.getValue(t);
+        real yValue = y.getValue(t);
+        r += xValue * phasorR[k] - yValue * phasorI[k];
+        i += xValue * phasorI[k] + yValue * phasorR[k];
+    }
+    return ComplexNumber(r * dt, i * dt);
+}
+
+#endif
+
+
+/******************************************************************************
+ * Runtime dispatch. The instruction set is detected the first time a
+ * kernel is called, and kept for the rest of the program.
+ * The FS_SIMD environment variable, set to "sse2" or "scalar", caps it,
+ * so that the slower versions can be tested on a machine with AVX2.
+******************************************************************************/
+
+enum class InstructionSet { SCALAR, SSE2, AVX2 };
+
+static InstructionSet detectInstructionSet(){
+    InstructionSet limit = InstructionSet::AVX2;
+    if(const char* requested = std::getenv("FS_SIMD")){
+        if(std::strcmp(requested, "scalar") == 0){
+            limit = InstructionSet::SCALAR;
+        }
+        else if(std::strcmp(requested, "sse2") == 0){
+            limit = InstructionSet::SSE2;
+        }
+    }
+
+#ifdef FS_SIMD_X86
+    __builtin_cpu_init();
+    if(limit >= InstructionSet::AVX2 && __builtin_cpu_supports("avx2")){
+        return InstructionSet::AVX2;
+    }
+    if(limit >= InstructionSet::SSE2 && __builtin_cpu_supports("sse2")){
+        return InstructionSet::SSE2;
+    }
+#endif
+    return InstructionSet::SCALAR;
+}
+
+static InstructionSet getDetectedInstructionSet(){
+    // Initialized once, thread safely
+    static const InstructionSet instructionSet = detectInstructionSet();
+    return instructionSet;
+}
+
+
+// Evaluate function definition
+void SimdKernels::evaluate(const PolynomialView& polynomial,
+    const real* times, real* values, int count){
+
+    switch(getDetectedInstructionSet()){
+#ifdef FS_SIMD_X86
+        case InstructionSet::AVX2:
+            evaluateAvx2(polynomial, times, values, count);
+            return;
+        case InstructionSet::SSE2:
+            evaluateSse2(polynomial, times, values, count);
+            return;
+#endif
+        default:
+            evaluateScalar(polynomial, times, values, count);
+    }
+}
+
+
+// Integrate function definition
+ComplexNumber SimdKernels::integrate(const PolynomialView& x,
+    const PolynomialView& y, real t0, real dt, int samples, int n){
+
+    switch(getDetectedInstructionSet()){
+#ifdef FS_SIMD_X86
+        case InstructionSet::AVX2:
+            return integrateAvx2(x, y, t0, dt, samples, n);
+        case InstructionSet::SSE2:
+            return integrateSse2(x, y, t0, dt, samples, n);
+#endif
+        default:
+            return integrateScalar(x, y, t0, dt, samples, n);
+    }
+}
+
+
+// Get instruction set function definition
+const char* SimdKernels::getInstructionSet(){
+    switch(getDetectedInstructionSet()){
+        case InstructionSet::AVX2:
+            return "avx2";
+        case InstructionSet::SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ * SimdKernels.h
+ * Header file for the SimdKernels class, which holds the batched versions
+ * of the loops that evaluate and integrate the Bezier curves.
+ * Each kernel has an AVX2 version working on 4 values of t at once, an
+ * SSE2 version working on 2, and a scalar version. The version used is
+ * picked once at runtime from the features of the CPU, so the same
+ * executable runs everywhere, and machines that are not x86 always use the
+ * scalar version.
+******************************************************************************/
+
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cmath>
+#include "Polynomial.h"
+#include "ComplexNumber.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * SimdKernels class definition.
+     * Like FourierSeries, this is a helper class with no member variables.
+     * The scalar versions are public so that the batched versions can be
+     * checked against them.
+    **************************************************************************/
+    class SimdKernels{
+    public:
+
+        /**********************************************************************
+         * Evaluates the polynomial at count values of t, writing the result
+         * for times[j] into values[j].
+         * All versions use the same Horner's rule steps in the same order,
+         * so their results are identical.
+        **********************************************************************/
+        static void evaluate(const PolynomialView& polynomial,
+            const real* times, real* values, int count);
+
+        /**********************************************************************
+         * Sums the rectangles of width dt of the function
+         * (x(t) + i * y(t)) * e^(2 * pi * i * n * t) at the samples
+         * t = t0 + s * dt for s = 0 to samples - 1.
+         * The batched versions only call sin and cos for their first
+         * samples, then rotate each lane's phasor by e^(2 * pi * i * n * L
+         * * dt) per step of L lanes, renormalizing it periodically. This
+         * agrees with the scalar version to around 1e-12 relative error.
+        **********************************************************************/
+        static ComplexNumber integrate(const PolynomialView& x,
+            const PolynomialView& y, real t0, real dt, int samples, int n);
+
+        // Scalar version of evaluate
+        static void evaluateScalar(const PolynomialView& polynomial,
+            const real* times, real* values, int count);
+
+        // Scalar version of integrate, which calls sin and cos per sample
+        static ComplexNumber integrateScalar(const PolynomialView& x,
+            const PolynomialView& y, real t0, real dt, int samples, int n);
+
+        /**********************************************************************
+         * Returns the name of the instruction set the kernels dispatch to,
+         * "avx2", "sse2" or "scalar". Setting the FS_SIMD environment
+         * variable to "sse2" or "scalar" keeps the kernels from using a
+         * faster one.
+        **********************************************************************/
+        static const char* getInstructionSet();
+    };
+}
+
+#endif
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Source file for the ThreadPool class member functions.
+******************************************************************************/
+
+#include "ThreadPool.h"
+
+using namespace fs;
+
+
+// Argumented constructor definition
+ThreadPool::ThreadPool(int workerCount) : queued{0}, pending{0},
+    stopping{false}, nextQueue{0} {
+
+    if(workerCount <= 0){
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for(int i = 0; i < workerCount; i++){
+        queues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue));
+    }
+    // The queues must all exist before any worker tries to steal
+    for(int i = 0; i < workerCount; i++){
+        workers.push_back(std::thread(&ThreadPool::work, this, i));
+    }
+}
+
+
+// Destructor definition
+ThreadPool::~ThreadPool(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for(auto& worker : workers){
+        worker.join();
+    }
+}
+
+
+// Worker count getter definition
+int ThreadPool::getWorkerCount() const{
+    return workers.size();
+}
+
+
+// Submit function definition
+void ThreadPool::submit(std::function<void()> task){
+    int index;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        index = nextQueue;
+        nextQueue = (nextQueue + 1) % queues.size();
+        queued++;
+        pending++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+
+// Wait function definition
+void ThreadPool::wait(){
+    std::unique_lock<std::mutex> lock(mutex);
+    tasksFinished.wait(lock, [this]{ return pending == 0; });
+
+    // The error is cleared so the pool can be reused
+    if(error){
+        std::exception_ptr thrown = error;
+        error = nullptr;
+        std::rethrow_exception(thrown);
+    }
+}
+
+
+// Take task function definition
+bool ThreadPool::takeTask(int index, std::function<void()>& task){
+    // A worker takes its newest task first, as it is the likeliest cached
+    {
+        TaskQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if(!own.tasks.empty()){
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Otherwise it steals the oldest task of another worker
+    for(int i = 1; i < queues.size(); i++){
+        TaskQueue& other = *queues[(index + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if(!other.tasks.empty()){
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Work function definition
+void ThreadPool::work(int index){
+    while(true){
+        std::function<void()> task;
+        if(takeTask(index, task)){
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queued--;
+            }
+
+            std::exception_ptr thrown;
+            try{
+                task();
+            }
+            catch(...){
+                thrown = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if(thrown && !error){
+                error = thrown;
+            }
+            pending--;
+            if(pending == 0){
+                tasksFinished.notify_all();
+            }
+            continue;
+        }
+
+        /**********************************************************************
+         * Sleeps until a task is submitted. A task may be counted before
+         * it is pushed, in which case the worker just tries again.
+        **********************************************************************/
+        std::unique_lock<std::mutex> lock(mutex);
+        taskAvailable.wait(lock, [this]{ return stopping || queued > 0; });
+        if(stopping && queued == 0){
+            return;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * ThreadPool.h
+ * Header file for the ThreadPool class, a fixed set of worker threads that
+ * run submitted tasks.
+ * Each worker owns a queue of tasks. Submitted tasks are spread over the
+ * queues in turn, each worker runs the tasks of its own queue, and when
+ * it runs out, it steals tasks from the other queues. This keeps every
+ * worker busy even when some tasks take much longer than others.
+******************************************************************************/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <algorithm>
+
+namespace fs {
+    /**************************************************************************
+     * ThreadPool class definition.
+     * The threads are started by the constructor and joined by the
+     * destructor, after the tasks already submitted have run.
+    **************************************************************************/
+    class ThreadPool{
+    private:
+
+        // A worker's queue of tasks and the mutex guarding it
+        struct TaskQueue{
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<TaskQueue>> queues;  // One per worker
+        std::vector<std::thread> workers;                // Worker threads
+
+        /**********************************************************************
+         * State shared by all the workers, guarded by mutex: the number of
+         * tasks waiting in the queues, the number of tasks not yet finished,
+         * the first exception thrown by a task, and whether the pool is
+         * being destroyed.
+        **********************************************************************/
+        std::mutex mutex;
+        std::condition_variable taskAvailable;
+        std::condition_variable tasksFinished;
+        int queued;
+        int pending;
+        std::exception_ptr error;
+        bool stopping;
+
+        // Index of the queue the next submitted task goes to
+        int nextQueue;
+
+        /**********************************************************************
+         * Takes a task for the worker with the given index, first from the
+         * back of its own queue, then from the front of the other queues.
+         * Returns false if every queue is empty.
+        **********************************************************************/
+        bool takeTask(int index, std::function<void()>& task);
+
+        // Function run by each worker thread until the pool is destroyed
+        void work(int index);
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, starts the given number of workers.
+         * A count of 0 or less uses one worker per hardware thread.
+        **********************************************************************/
+        ThreadPool(int workerCount);
+
+        // Destructor, waits for the submitted tasks and joins the workers
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        int getWorkerCount() const;     // Getter for the number of workers
+
+        // Adds a task to be run by one of the workers
+        void submit(std::function<void()> task);
+
+        /**********************************************************************
+         * Blocks until every submitted task has finished. If a task threw
+         * an exception, the first one is rethrown here.
+         * Must not be called from inside a task.
+        **********************************************************************/
+        void wait();
+    };
+}
+
+#endif
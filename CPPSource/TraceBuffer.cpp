@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Source file for the TraceBuffer class member functions.
+******************************************************************************/
+
+#include "TraceBuffer.h"
+
+#ifndef FS_HEADLESS
+
+using namespace fs;
+
+
+// Argumented constructor definition
+TraceBuffer::TraceBuffer(int capacity, const sf::Color& color)
+    : capacity{capacity}, start{0}, count{0}, frozen{false},
+    cache(sf::LineStrip, sf::VertexBuffer::Static), cached{false} {
+
+    if(capacity < 1){
+        throw std::invalid_argument("The capacity must be at least 1");
+    }
+    vertices.assign(2 * capacity, sf::Vertex(sf::Vector2f(0, 0), color));
+}
+
+
+// Append function definition
+void TraceBuffer::append(const ComplexNumber& point){
+    if(frozen){
+        return;
+    }
+
+    int index = (start + count) % capacity;
+    sf::Vector2f position(point.getReal(), point.getImaginary());
+    vertices[index].position = position;
+    vertices[index + capacity].position = position;
+
+    if(count < capacity){
+        count++;
+    }
+    else{
+        start = (start + 1) % capacity;
+    }
+}
+
+
+// Freeze function definition
+void TraceBuffer::freeze(const std::vector<ComplexNumber>& path){
+    if(path.size() >= capacity){
+        throw std::invalid_argument("The path does not fit in the buffer");
+    }
+
+    start = 0;
+    count = 0;
+    for(const ComplexNumber& point : path){
+        append(point);
+    }
+    if(!path.empty()){
+        append(path.front());
+    }
+    frozen = true;
+
+    // The frozen path never changes, so it can stay in graphics memory
+    cached = sf::VertexBuffer::isAvailable() && cache.create(count)
+        && cache.update(vertices.data());
+}
+
+
+// Is frozen function definition
+bool TraceBuffer::isFrozen() const{
+    return frozen;
+}
+
+
+// Get point number function definition
+int TraceBuffer::getPointNumber() const{
+    return count;
+}
+
+
+// Draw function definition
+void TraceBuffer::draw(sf::RenderTarget& target,
+    sf::RenderStates states) const{
+
+    if(cached){
+        target.draw(cache, states);
+    }
+    else if(count > 0){
+        target.draw(&vertices[start], count, sf::LineStrip, states);
+    }
+}
+
+#endif
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * TraceBuffer.h
+ * Header file for the TraceBuffer class, which holds the path traced by
+ * the tip of the circles in the SFML window.
+ * An sf::VertexArray appended to every frame grows without limit, and is
+ * redrawn in full each frame, so a window left running slowly uses more
+ * memory and time. The buffer instead has a fixed capacity allocated once.
+ * If more points are added than it can hold, the oldest ones are dropped,
+ * and once the path has been drawn for a full period it is frozen, and
+ * stays the same from then on.
+ * It only exists in the SFML build.
+******************************************************************************/
+
+#ifndef TRACE_BUFFER_H
+#define TRACE_BUFFER_H
+
+#ifndef FS_HEADLESS
+
+#include <vector>
+#include <stdexcept>
+#include <SFML/Graphics.hpp>
+#include "ComplexNumber.h"
+#include "unit.h"
+
+namespace fs {
+    /**************************************************************************
+     * TraceBuffer class definition.
+     * The points are kept in a ring, each written twice, at its position
+     * and capacity places after it. The newest points are then always
+     * contiguous, from the oldest to the newest, and are drawn as a single
+     * strip.
+     * When frozen, the path is uploaded once to a vertex buffer in the
+     * graphics memory if the system supports them, and drawn from there.
+    **************************************************************************/
+    class TraceBuffer : public sf::Drawable{
+    private:
+
+        std::vector<sf::Vertex> vertices;   // The ring, written twice
+        int capacity;       // Points held at most
+        int start;          // Position of the oldest point in the ring
+        int count;          // Points currently held
+
+        bool frozen;                // Whether the path no longer changes
+        sf::VertexBuffer cache;     // Frozen path, if vertex buffers work
+        bool cached;                // Whether the cache holds the path
+
+        // Draws the points held, called by window.draw(trace)
+        void draw(sf::RenderTarget& target,
+            sf::RenderStates states) const override;
+
+    public:
+
+        /**********************************************************************
+         * Argumented constructor, takes the number of points held at most,
+         * which must be at least 1, and the color of the path.
+        **********************************************************************/
+        TraceBuffer(int capacity, const sf::Color& color);
+
+        /**********************************************************************
+         * Adds a point to the end of the path, dropping the oldest point if
+         * the buffer is full. Does nothing once the buffer is frozen.
+        **********************************************************************/
+        void append(const ComplexNumber& point);
+
+        /**********************************************************************
+         * Replaces the path with the given closed loop, such as the one
+         * returned by FourierSeries::reconstructPath, and freezes it.
+         * The loop goes back to its first point, so it must have fewer
+         * points than the capacity.
+        **********************************************************************/
+        void freeze(const std::vector<ComplexNumber>& path);
+
+        // Returns whether the path has been frozen
+        bool isFrozen() const;
+
+        // Returns the number of points held
+        int getPointNumber() const;
+    };
+}
+
+#endif
+
+#endif
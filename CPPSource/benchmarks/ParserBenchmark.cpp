@@ -0,0 +1,180 @@
+/******************************************************************************
+ * ParserBenchmark.cpp
+ * Measures how fast the path data of the svg files in svg/ is parsed, by
+ * FourierSeries::parseSVGPath with its SVGPathTokenizer, and by the
+ * parser it replaced, which read each command and number from a
+ * std::istringstream and allocated a vector for each curve. That parser is
+ * kept below as the baseline.
+ * Built and run from CPPSource by the Makefile's parser-benchmark target.
+******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "FourierSeries.h"
+#include "MappedFile.h"
+#include "PathPoints.h"
+#include "Point.h"
+
+using namespace fs;
+
+// Seconds each parser is timed for on each file, at least
+static const double MINIMUM_TIME = 0.25;
+
+
+/******************************************************************************
+ * The stream parser, as FourierSeries::parseSVGPath was before the
+ * tokenizer. It only understands absolute M, L, Q, C and z commands with
+ * separated numbers, which is all the bundled files use.
+******************************************************************************/
+static std::vector<std::vector<Point>> parseWithStream(
+    const std::string& pathData){
+
+    std::vector<std::vector<Point>> vectorOfPoints;
+
+    // Create a string stream from the SVG path data
+    std::istringstream pathStream(pathData);
+
+    char command;
+    double x, y;
+    Point temp;
+
+    while (pathStream >> command) {
+
+        std::vector<Point> points;
+
+        switch (command) {
+            case 'M':
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                break;
+            case 'L':
+                points.push_back(temp);
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                points.push_back(temp);
+                vectorOfPoints.push_back(points);
+                break;
+            case 'Q':
+                points.push_back(temp);
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                points.push_back(temp);
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                points.push_back(temp);
+                vectorOfPoints.push_back(points);
+                break;
+            case 'C':
+                points.push_back(temp);
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                points.push_back(temp);
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                points.push_back(temp);
+                pathStream >> x >> y;
+                temp = Point(x, y);
+                points.push_back(temp);
+                vectorOfPoints.push_back(points);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return vectorOfPoints;
+}
+
+
+/******************************************************************************
+ * Calls parse until MINIMUM_TIME has passed, and returns the throughput in
+ * MB/s of the given number of bytes per call. curves is set to the number
+ * of curves of one call.
+******************************************************************************/
+template<class F>
+static double measure(F parse, std::size_t bytes, int& curves){
+    using Clock = std::chrono::steady_clock;
+    long long calls = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed;
+    do{
+        curves = parse();
+        calls++;
+        elapsed = std::chrono::duration<double>(Clock::now() - start)
+            .count();
+    } while(elapsed < MINIMUM_TIME);
+    return bytes * calls / elapsed / 1e6;
+}
+
+
+int main(){
+    FourierSeries f;
+
+    std::vector<std::string> files;
+    for(const auto& entry : std::filesystem::directory_iterator("svg")){
+        if(entry.path().extension() == ".svg"){
+            files.push_back(entry.path().string());
+        }
+    }
+    if(files.empty()){
+        std::fprintf(stderr, "No svg files found, run from CPPSource\n");
+        return EXIT_FAILURE;
+    }
+    std::sort(files.begin(), files.end());
+
+    std::printf("%-20s %10s %8s %12s %12s %8s\n", "file", "path bytes",
+        "curves", "stream MB/s", "tokens MB/s", "speedup");
+
+    std::size_t totalBytes = 0;
+    double streamTime{0}, tokenTime{0};
+    for(const std::string& file : files){
+        MappedFile svg(file);
+        std::vector<std::string_view> paths = f.findPathData(svg.getView());
+        std::size_t bytes = 0;
+        for(std::string_view path : paths){
+            bytes += path.size();
+        }
+
+        int streamCurves, tokenCurves;
+        double streamRate = measure([&]{
+            int curves = 0;
+            for(std::string_view path : paths){
+                curves += parseWithStream(std::string(path)).size();
+            }
+            return curves;
+        }, bytes, streamCurves);
+
+        PathPoints points;
+        double tokenRate = measure([&]{
+            points = PathPoints();
+            for(std::string_view path : paths){
+                f.parseSVGPath(path, points);
+            }
+            return points.getCurveNumber();
+        }, bytes, tokenCurves);
+
+        std::printf("%-20s %10zu %8d %12.1f %12.1f %7.1fx\n", file.c_str(),
+            bytes, tokenCurves, streamRate, tokenRate,
+            tokenRate / streamRate);
+        if(streamCurves != tokenCurves){
+            std::printf("  the stream parser found %d curves\n",
+                streamCurves);
+        }
+
+        totalBytes += bytes;
+        streamTime += bytes / streamRate;
+        tokenTime += bytes / tokenRate;
+    }
+
+    std::printf("%-20s %10zu %8s %12.1f %12.1f %7.1fx\n", "all", totalBytes,
+        "", totalBytes / streamTime, totalBytes / tokenTime,
+        streamTime / tokenTime);
+    return EXIT_SUCCESS;
+}
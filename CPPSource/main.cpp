@@ -1,12 +1,25 @@
 
+// Built with FS_HEADLESS defined, the frames are rendered without SFML
+#ifndef FS_HEADLESS
 // Also defined in the makefile
 #define SFML_STATIC
 
 #include <SFML/Graphics.hpp>
+#include "CircleScene.h"
+#include "TraceBuffer.h"
+#else
+#include <cstdio>
+#include <filesystem>
+#include "FrameExporter.h"
+#include "ImageWriter.h"
+#endif
+
 #include <iostream>
 #include <vector>
 
 #include "FourierSeries.h"
+#include "AnimationEngine.h"
+#include "CoefficientCache.h"
 
 int main() {
 
@@ -18,6 +31,14 @@ int main() {
     // Lower it more when working with images with straight lines, as they
     // require more precision to come out looking accurate and un-spiky.
     fs::real integrationInterval = 0.0001;
+    // EXACT computes the circles in closed form and ignores the interval
+    // above, RIEMANN_SUM and FFT sample the curves using the interval.
+    // GAUSS_LEGENDRE evaluates 8 nodes per sub-interval, so it has its own
+    // interval, where AUTOMATIC_DT uses as few as each circle's speed allows.
+    fs::IntegrationMethod integrationMethod = fs::IntegrationMethod::EXACT;
+    fs::real gaussLegendreInterval = fs::IntegrationPolicy::AUTOMATIC_DT;
+    // Number of threads used to generate the circles, 0 uses all cores.
+    int workerCount = 0;
     int canvasSize = 800; // In px
     int frameRate = 60;
     // A low animation time means there won't be enough frames to smoothly
@@ -28,6 +49,24 @@ int main() {
     // True when we want to show the circles and the vectors in the image
     // drawing process, false when we only want to show the vectors.
     bool showCircles = true;
+    // The circles are kept in the cache directory, and only generated again
+    // when the file or the parameters above change.
+    bool useCache = true;
+    std::string cacheDirectory = "cache";
+    // Circles with a smaller radius (in px) aren't drawn, though they still
+    // move the tip. Most of the fast circles are far below a pixel.
+    fs::real minimumCircleRadius = 0.5;
+#ifdef FS_HEADLESS
+    // Format of the frames: "ppm" or "png" files in outputDirectory, or
+    // "raw" RGBA bytes on the standard output, for a video encoder.
+    std::string outputFormat = "ppm";
+    std::string outputDirectory = "frames";
+
+    // The standard output may carry the frames, so the logs go to stderr
+    std::ostream& console = std::cerr;
+#else
+    std::ostream& console = std::cout;
+#endif
 
     /**************************************************************************
      * Since we set the Bezier Curve to start and finish at 0 and 1 seconds
@@ -43,46 +82,111 @@ int main() {
 
     fs::FourierSeries fourierSeries;
     
-    // The svg path
-    std::string path = fourierSeries.parseSVG(filePath);
-    std::cout << path << "\n\n"; 
-
-    // The points in each bezier curve, parsed from the path
-    std::vector<std::vector<fs::Point>> points = 
-        fourierSeries.parseSVGPath(path);
-    for (const auto& curve : points) {
-        for (const auto& point : curve) {
-            std::cout << point << " ";
+    // The svg file is mapped, and every path in it parsed in place
+    fs::MappedFile svgFile(filePath);
+    fs::IntegrationPolicy policy(integrationMethod,
+        integrationMethod == fs::IntegrationMethod::GAUSS_LEGENDRE
+        ? gaussLegendreInterval : integrationInterval);
+
+    // One point of the path per frame of the first turn
+    int frameCount = animationTime / (1000 / frameRate);
+
+    /**************************************************************************
+     * The circles of a file already drawn with the same parameters are
+     * loaded from the cache, skipping the parsing and the integration.
+    **************************************************************************/
+    fs::CoefficientCache cache(cacheDirectory);
+    std::uint64_t cacheKey = fs::CoefficientCache::hash(svgFile.getView(),
+        numberOfCircles, policy, canvasSize);
+    std::vector<fs::ComplexNumber> circles;
+    if(useCache && cache.load(cacheKey, circles)){
+        console << "Circles loaded from the cache\n\n";
+    }
+    else{
+        std::vector<fs::PathPoints> subpaths =
+            fourierSeries.parseSVGSubpaths(svgFile.getView(), workerCount);
+        console << subpaths.size() << " subpaths\n\n";
+
+        // The points in each bezier curve, with all the subpaths joined into
+        // a single loop that one Fourier series can draw
+        fs::PathPoints points = fourierSeries.stitchSubpaths(subpaths);
+        for (int i = 0; i < points.getCurveNumber(); i++) {
+            const fs::Point* curve = points.getCurve(i);
+            for (int j = 0; j < points.getPointNumber(i); j++) {
+                console << curve[j] << " ";
+            }
+            console << "\n";
+        }
+        console << "\n\n";
+
+        // Now the points needs to be translated and scaled so they're in the
+        // middle of the canvas and fit well.
+        fourierSeries.movePointsToMinimizeDistance(points);
+        fourierSeries.scalePoints(points, canvasSize);
+
+        // The bezier curves in their parametric forms, where the ith curve
+        // starts at t = i and ends at t = i+1 starting with curve 0, and
+        // ending with the curve that connects back to it.
+        fs::BezierCurveVector bezierCurveVector = 
+            fourierSeries.generateBezierCurveVector(points);
+        console << bezierCurveVector << "\n\n";
+
+        // The complex numbers generated in order to draw the image path
+        // using a fourier series (with n circles).
+        circles = fourierSeries.generateCircles(numberOfCircles,
+            bezierCurveVector, policy, workerCount);
+
+        console << "Reconstruction error: " << fourierSeries
+            .findReconstructionError(circles, bezierCurveVector, frameCount)
+            << "\n\n";
+
+        if(useCache){
+            try{
+                cache.store(cacheKey, circles);
+            }
+            catch(const std::exception& error){
+                // The circles are still drawn, only the next run is slower
+                console << error.what() << "\n\n";
+            }
         }
-        std::cout << "\n";
     }
-    std::cout << "\n\n";
-
-    // Now the points needs to be translated and scaled so they're in the
-    // middle of the canvas and fit well.
-    fourierSeries.movePointsToMinimizeDistance(points);
-    fourierSeries.scalePoints(points, canvasSize);
-
-    // The bezier curves in their parametric forms, where the ith curve starts
-    // at t = i and ends at t = i+1 starting with curve 0, and ending with
-    // the curve that connects back to it.
-    fs::BezierCurveVector bezierCurveVector = 
-        fourierSeries.generateBezierCurveVector(points);
-    std::cout << bezierCurveVector << "\n\n";
-    
-    // The complex numbers generated in order to draw the image path using 
-    // a fourier series (with n circles).
-    std::vector<fs::ComplexNumber> circles = fourierSeries.generateCircles(
-        integrationInterval,
-        numberOfCircles,
-        bezierCurveVector
-    );
     for (int i = 0; i < circles.size(); i++) {
-        std::cout << "Vector [" << i << "]: " << circles[i] << "\n";
+        console << "Vector [" << i << "]: " << circles[i] << "\n";
     }
-    std::cout << "\n\n";
+    console << "\n\n";
+
 
+#ifdef FS_HEADLESS
+    /**************************************************************************
+     * Renders one turn of the animation, the frames after that showing the
+     * finished drawing only.
+    **************************************************************************/
+    if(outputFormat != "raw"){
+        std::filesystem::create_directories(outputDirectory);
+    }
 
+    // The frames are rendered on workerCount threads and written in order
+    fs::FrameExporter exporter(canvasSize, showCircles,
+        minimumCircleRadius, workerCount);
+    exporter.exportFrames(circles, angleOffset, frameCount,
+        [&](int frame, const fs::Framebuffer& image){
+            if(outputFormat == "raw"){
+                fs::ImageWriter::writeRaw(image, std::cout);
+                return;
+            }
+            char name[32];
+            std::snprintf(name, sizeof(name), "/frame_%05d.", frame);
+            std::string file = outputDirectory + name + outputFormat;
+            if(outputFormat == "png"){
+                fs::ImageWriter::writePNG(image, file);
+            }
+            else{
+                fs::ImageWriter::writePPM(image, file);
+            }
+        });
+    std::cout.flush();
+    console << frameCount << " frames rendered\n";
+#else
     // This part shows the Fourier Series drawing the image
 
     sf::ContextSettings settings;
@@ -94,9 +198,14 @@ int main() {
     sf::View view(sf::Vector2f(0, 0), sf::Vector2f(canvasSize, canvasSize));
     window.setView(view);
 
-    sf::VertexArray imageShape(sf::LineStrip);
-    // Total angle rotated, used to determine how many loops we've done
-    fs::real totalAngle = 0;
+    // The path traced during the first turn, which then stays as it is
+    fs::TraceBuffer imageShape(frameCount + 1, sf::Color::Red);
+    // Turns the circles by angleOffset times their speed each frame, and
+    // keeps the total angle, used to determine how many loops we've done
+    fs::AnimationEngine animationEngine(circles, angleOffset);
+    // The circles and vectors, allocated once and moved every frame
+    fs::CircleScene scene(circles, showCircles, minimumCircleRadius);
+    console << scene.getVisibleCircleNumber() << " circles drawn\n\n";
 
     while (window.isOpen()) {
         sf::Event event;
@@ -106,63 +215,32 @@ int main() {
             }
         }
 
-        // Draws the vectors drawing the image
-        sf::VertexArray vectors(sf::LineStrip);
-        vectors.append(sf::Vertex(sf::Vector2f(0, 0), sf::Color::Blue));
-        // Draws the circles in which the vectors rotate
-        std::vector<sf::CircleShape> circleShapes;
-
-        fs::ComplexNumber tip;
-        for(int i = 0; i < circles.size(); i++){
-
-            sf::CircleShape circleShape;
-            circleShape.setRadius(circles[i].getMagnitude());
-            circleShape.setPosition(tip.getReal(), tip.getImaginary());
-            circleShape.setOrigin(circleShape.getRadius(),
-                circleShape.getRadius());
-            circleShape.setOutlineThickness(1);
-            circleShape.setFillColor(sf::Color::Transparent);
-            sf::Color outlineColor = sf::Color(255, 255, 255);
-            outlineColor.a = 40;  // Opacity
-            circleShape.setOutlineColor(outlineColor);
-            circleShapes.push_back(circleShape);
-
-            // The first circle does not rotate
-            if(i == 0){
-                tip += circles[i];
-            }
-            else {
-                if(i % 2 == 1){
-                    circles[i].addAngle(angleOffset * ((i+1)/2));
-                } else {
-                    circles[i].addAngle(angleOffset * -(i/2));
-                }
-                tip += circles[i];
-            }
-            vectors.append(sf::Vertex(sf::Vector2f(tip.getReal(), 
-                tip.getImaginary()), sf::Color::Blue));
-        }
+        animationEngine.advance();
 
-        imageShape.append(sf::Vertex(sf::Vector2f(tip.getReal(), 
-            tip.getImaginary()), sf::Color::Red));
+        // Only draws the fourier series the first loop, then just displays
+        // the drawn image alone (since a fourier series is periodic).
+        bool drawing = animationEngine.getTotalAngle() < 2 * fs::PI;
 
-        totalAngle += angleOffset;
+        if(drawing){
+            scene.update(animationEngine);
+            imageShape.append(scene.getTip());
+        }
+        else if(!imageShape.isFrozen()){
+            // Replaces the traced path with the whole closed loop
+            imageShape.freeze(fourierSeries.reconstructPath(circles,
+                frameCount));
+        }
 
         window.setFramerateLimit(frameRate);
         window.clear();
-        // Only draws the fourier series the first loop, then just displays
-        // the drawn image alone (since a fourier series is periodic).
-        if(totalAngle < 2 * fs::PI){
-            if(showCircles){
-                for(int i = 0; i < numberOfCircles; i++){
-                    window.draw(circleShapes[i]);
-                }
-            }
-            window.draw(vectors);
+        if(drawing){
+            window.draw(scene);
         }
         window.draw(imageShape);
         window.display();
     }
 
+#endif
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * AllocationTest.cpp
+ * Checks that generating the circles allocates memory a number of times
+ * that depends on the number of curves, and not on the number of samples.
+ * The global operator new is replaced by one that counts its calls, and
+ * the circles of the same path are generated with steps 100 times apart,
+ * which must not change the count. A copy of a Polynomial in the loop
+ * over the samples, for instance, would add millions of allocations.
+ * Moving points of a FourierSession, which rewrites the curves in place,
+ * must not allocate at all.
+ * Built and run by the Makefile's allocation-test target.
+******************************************************************************/
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+#include "FourierSeries.h"
+#include "FourierSession.h"
+#include "BezierCurveVector.h"
+#include "IntegrationMethod.h"
+#include "IntegrationPolicy.h"
+#include "Point.h"
+
+using namespace fs;
+
+static std::atomic<long long> allocations{0};
+
+void* operator new(std::size_t size){
+    allocations++;
+    if(void* memory = std::malloc(size ? size : 1)){
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size){
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept{
+    std::free(memory);
+}
+
+
+// Builds a closed path of the given number of random curves of degree 1-3
+static BezierCurveVector generatePath(int curves){
+    std::mt19937 generator(curves);
+    std::uniform_real_distribution<real> coordinate(-300, 300);
+    std::uniform_int_distribution<int> degree(1, 3);
+
+    BezierCurveVector h(1.0 / curves);
+    Point first(coordinate(generator), coordinate(generator));
+    Point start = first;
+    for(int i = 0; i < curves; i++){
+        std::vector<Point> points{start};
+        int count = degree(generator);
+        for(int j = 1; j < count; j++){
+            points.push_back(Point(coordinate(generator),
+                coordinate(generator)));
+        }
+        start = (i == curves - 1) ? first
+            : Point(coordinate(generator), coordinate(generator));
+        points.push_back(start);
+        h.addBezierCurve(points);
+    }
+    return h;
+}
+
+
+// Counts the allocations of one call to generateCircles
+static long long countAllocations(const FourierSeries& f,
+    const BezierCurveVector& h, real dt, int n, IntegrationMethod method,
+    int workers){
+
+    long long before = allocations;
+    std::vector<ComplexNumber> circles = (workers == 0)
+        ? f.generateCircles(dt, n, h, method)
+        : f.generateCircles(dt, n, h, method, workers);
+    return allocations - before;
+}
+
+
+int main(){
+    FourierSeries f;
+    const int n = 51;
+    int failures = 0;
+
+    const IntegrationMethod methods[] = {IntegrationMethod::RIEMANN_SUM,
+        IntegrationMethod::EXACT, IntegrationMethod::GAUSS_LEGENDRE,
+        IntegrationMethod::ADAPTIVE};
+    const char* names[] = {"riemann", "exact", "gauss-legendre",
+        "adaptive"};
+
+    for(int curves : {10, 100}){
+        BezierCurveVector h = generatePath(curves);
+        for(int m = 0; m < 4; m++){
+            // 0 workers calls the serial overload
+            for(int workers : {0, 2}){
+                // The first call also fills caches, such as the nodes
+                countAllocations(f, h, 1e-3, n, methods[m], workers);
+                long long coarse = countAllocations(f, h, 1e-3, n,
+                    methods[m], workers);
+                long long fine = countAllocations(f, h, 1e-5, n,
+                    methods[m], workers);
+
+                /**************************************************************
+                 * Besides the result, and the tasks of the pool, which
+                 * depend on the number of circles, there can be a few
+                 * allocations per curve, but none per sample, so the
+                 * count must not grow with the 100 times more samples.
+                **************************************************************/
+                bool passed = fine <= coarse
+                    && fine <= 4 * curves + 4 * n + 64;
+                std::printf("%s %-14s curves %3d workers %d: %lld "
+                    "allocations at dt = 1e-3, %lld at dt = 1e-5\n",
+                    passed ? "PASS" : "FAIL", names[m], curves, workers,
+                    coarse, fine);
+                failures += !passed;
+            }
+        }
+    }
+
+    /**************************************************************************
+     * The edits move end points, which moves the neighbouring curves too,
+     * and inner points, around the closed path.
+    **************************************************************************/
+    BezierCurveVector h = generatePath(100);
+    FourierSession session(h, n, IntegrationPolicy(IntegrationMethod::EXACT,
+        1e-4), 1);
+    long long before = allocations;
+    for(int edit = 0; edit < 1000; edit++){
+        int curve = edit % h.getBezierCurveNumber();
+        int index = edit % h.getPointNumber(curve);
+        Point point = h.getPoint(curve, index);
+        session.movePoint(curve, index, Point(point.getX() + edit % 7,
+            point.getY() - edit % 5));
+    }
+    long long edits = allocations - before;
+
+    bool passed = edits == 0;
+    std::printf("%s session edits: %lld allocations for 1000 moved points\n",
+        passed ? "PASS" : "FAIL", edits);
+    failures += !passed;
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
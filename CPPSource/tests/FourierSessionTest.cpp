@@ -0,0 +1,139 @@
+/******************************************************************************
+ * FourierSessionTest.cpp
+ * Checks that the circles of a FourierSession, after its curves are
+ * edited, are those generateCircles gives for the edited path, which the
+ * test edits on its own copy of the control points.
+ * The path is the closed tour main.cpp draws, and the edits move the
+ * start of its first curve, the end of its last curve, which is the same
+ * point, and control points in the middle, so that a gap left where the
+ * path closes would show up as a difference in the circles. A last edit
+ * gives a curve one more point, which changes its degree.
+ * Built and run from CPPSource by the Makefile's session-test target.
+******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "FourierSeries.h"
+#include "FourierSession.h"
+#include "BezierCurveVector.h"
+#include "IntegrationPolicy.h"
+#include "MappedFile.h"
+#include "PathPoints.h"
+#include "Point.h"
+
+using namespace fs;
+
+// Largest difference allowed between the session and a full generation
+static const real TOLERANCE = 1e-9;
+
+
+// Builds a path from the control points of its curves
+static BezierCurveVector buildPath(std::vector<std::vector<Point>>& curves,
+    real interval){
+
+    BezierCurveVector h(interval);
+    for(std::vector<Point>& points : curves){
+        h.addBezierCurve(points);
+    }
+    return h;
+}
+
+
+// Compares the circles of the session with those of the edited copy
+static bool compare(const FourierSeries& f, const FourierSession& session,
+    std::vector<std::vector<Point>>& curves, real interval,
+    const IntegrationPolicy& policy, const char* name){
+
+    int n = session.getCircles().size();
+    std::vector<ComplexNumber> expected = f.generateCircles(n,
+        buildPath(curves, interval), policy);
+    real difference{0};
+    for(int i = 0; i < n; i++){
+        difference = std::max(difference,
+            (session.getCircles()[i] - expected[i]).getMagnitude());
+    }
+
+    bool passed = difference <= TOLERANCE;
+    std::printf("%s %s: largest difference %.3g\n",
+        passed ? "PASS" : "FAIL", name, difference);
+    return passed;
+}
+
+
+int main(){
+    FourierSeries f;
+    MappedFile svg("svg/lebanon.svg");
+    PathPoints points = f.stitchSubpaths(f.parseSVGSubpaths(svg.getView(),
+        0));
+    f.movePointsToMinimizeDistance(points);
+    f.scalePoints(points, 800);
+    BezierCurveVector h = f.generateBezierCurveVector(points);
+
+    const int n = 101;
+    IntegrationPolicy policy(IntegrationMethod::EXACT, 1e-4);
+    FourierSession session(h, n, policy, 0);
+
+    /**************************************************************************
+     * The copy of the path, in which a moved end point also moves the
+     * point it is shared with, the first and last curves sharing one.
+    **************************************************************************/
+    std::vector<std::vector<Point>> curves(h.getBezierCurveNumber());
+    for(int i = 0; i < curves.size(); i++){
+        BezierCurve curve = h.getBezierCurve(i);
+        for(int j = 0; j < curve.getPointNumber(); j++){
+            curves[i].push_back(curve.getPoint(j));
+        }
+    }
+    int last = curves.size() - 1;
+    if(!(curves.front().front() == curves.back().back())){
+        std::printf("FAIL the tour is not closed\n");
+        return EXIT_FAILURE;
+    }
+    int failures = 0;
+
+    struct Edit{
+        const char* name;
+        int curve;
+        int index;          // Point moved, -1 for the last one
+    };
+    const Edit edits[] = {
+        {"start of the first curve", 0, 0},
+        {"end of the last curve", last, -1},
+        {"end of a middle curve", last / 2, -1},
+        {"second point of a middle curve", last / 3, 1}
+    };
+
+    for(const Edit& edit : edits){
+        std::vector<Point>& edited = curves[edit.curve];
+        int index = (edit.index < 0) ? edited.size() - 1 : edit.index;
+        Point point(edited[index].getX() + 37, edited[index].getY() - 23);
+
+        session.movePoint(edit.curve, index, point);
+        edited[index] = point;
+        if(index == 0){
+            curves[(edit.curve + last) % curves.size()].back() = point;
+        }
+        if(index == edited.size() - 1){
+            curves[(edit.curve + 1) % curves.size()].front() = point;
+        }
+
+        failures += !compare(f, session, curves, h.getInterval(), policy,
+            edit.name);
+    }
+
+    /**************************************************************************
+     * A curve given one more point moves to the group of the next degree,
+     * and the curve moved into the slot it leaves must keep its own
+     * coefficients, so the circles catch a mix-up of the slots.
+    **************************************************************************/
+    std::vector<Point>& raised = curves[last / 4];
+    raised.insert(raised.begin() + 1, Point(raised.front().getX() + 51,
+        raised.front().getY() + 17));
+    session.setPoints(last / 4, raised);
+    failures += !compare(f, session, curves, h.getInterval(), policy,
+        "point added to a curve");
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
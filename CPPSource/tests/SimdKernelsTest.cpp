@@ -0,0 +1,109 @@
+/******************************************************************************
+ * SimdKernelsTest.cpp
+ * Checks the batched kernels of SimdKernels against their scalar versions,
+ * on curves with random control points, at several frequencies, and for
+ * numbers of samples that are and aren't multiples of the SIMD width, so
+ * that the loops over the remaining samples are covered too.
+ * The kernels dispatch to the best instruction set of the CPU, which the
+ * FS_SIMD environment variable can lower, so the Makefile's simd-test
+ * target runs this once for each of "avx2", "sse2" and "scalar".
+******************************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "SimdKernels.h"
+#include "BezierCurve.h"
+#include "Polynomial.h"
+#include "Point.h"
+#include "unit.h"
+
+using namespace fs;
+
+// Largest relative error allowed between a batched and a scalar result
+static const real TOLERANCE = 1e-12;
+
+
+int main(){
+    std::mt19937 generator(6);
+    std::uniform_real_distribution<real> coordinate(-400, 400);
+    std::uniform_real_distribution<real> start(0, 0.5);
+
+    const int counts[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 13, 17, 64, 65, 255,
+        1000, 1003};
+    const int frequencies[] = {0, 1, -2, 7, -31, 150, -1000};
+
+    real evaluateError{0}, integrateError{0};
+    int failures = 0;
+
+    for(int degree = 1; degree <= 5; degree++){
+        for(int trial = 0; trial < 4; trial++){
+            std::vector<Point> points;
+            for(int i = 0; i <= degree; i++){
+                points.push_back(Point(coordinate(generator),
+                    coordinate(generator)));
+            }
+            real t0 = start(generator);
+            BezierCurve curve(points, t0, t0 + 0.1);
+            PolynomialView x = curve.getXView();
+            PolynomialView y = curve.getYView();
+
+            for(int count : counts){
+                real dt = 0.1 / std::max(count, 1);
+
+                std::vector<real> times(count), values(count),
+                    expected(count);
+                for(int j = 0; j < count; j++){
+                    times[j] = t0 + j * dt;
+                }
+                SimdKernels::evaluate(x, times.data(), values.data(), count);
+                SimdKernels::evaluateScalar(x, times.data(),
+                    expected.data(), count);
+                for(int j = 0; j < count; j++){
+                    real error = std::abs(values[j] - expected[j])
+                        / std::max(std::abs(expected[j]), 1e-300);
+                    evaluateError = std::max(evaluateError, error);
+                    if(error > TOLERANCE){
+                        std::printf("FAIL evaluate degree %d count %d "
+                            "sample %d: %.17g instead of %.17g\n", degree,
+                            count, j, values[j], expected[j]);
+                        failures++;
+                    }
+                }
+
+                /**************************************************************
+                 * The integral can cancel down to nearly 0, so the error
+                 * is relative to the integral of the magnitude of the
+                 * integrand, which bounds the rounding of every sample.
+                **************************************************************/
+                real scale{0};
+                for(int j = 0; j < count; j++){
+                    scale += std::hypot(x.getValue(times[j]),
+                        y.getValue(times[j])) * dt;
+                }
+                for(int n : frequencies){
+                    ComplexNumber result = SimdKernels::integrate(x, y, t0,
+                        dt, count, n);
+                    ComplexNumber reference = SimdKernels::integrateScalar(x,
+                        y, t0, dt, count, n);
+                    real error = (result - reference).getMagnitude()
+                        / std::max(scale, 1e-300);
+                    integrateError = std::max(integrateError, error);
+                    if(error > TOLERANCE){
+                        std::printf("FAIL integrate degree %d count %d "
+                            "n %d: relative error %.3g\n", degree, count, n,
+                            error);
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+
+    std::printf("%s %s: largest relative error %.3g evaluating, %.3g "
+        "integrating\n", failures == 0 ? "PASS" : "FAIL",
+        SimdKernels::getInstructionSet(), evaluateError, integrateError);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
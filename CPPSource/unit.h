@@ -11,14 +11,19 @@
 namespace fs {
     /**************************************************************************
      * Defines a numeric typedef to easily change precision.
-     * Use double not float, as float is not precise enough for some small
-     * angle nudges we need to rotate vectors in, and the inaccuracy builds
-     * up. The Fourier series starts off accurate, but quickly becomes
-     * chaotic.
+     * Use double not float, as float is not precise enough for the
+     * integrals the circles are computed from. The small angle nudges that
+     * rotate the circles used to build up error too, but AnimationEngine
+     * now recomputes them exactly every few frames, so that error stays
+     * bounded.
     **************************************************************************/ 
     typedef double real;
-    // Defines the mathematical constant PI
-    constexpr real PI = 3.141592;
+    /**************************************************************************
+     * Defines the mathematical constant PI.
+     * Given to full double precision, since the roots of unity used by the
+     * Fourier transform must be exact for the transform to be invertible.
+    **************************************************************************/
+    constexpr real PI = 3.14159265358979323846;
 }
 
 #endif
\ No newline at end of file